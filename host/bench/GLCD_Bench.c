@@ -0,0 +1,364 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Bench
+ * @brief Standard benchmark scenes, run against the emulated controller
+ * @details Each scene is a fixed drawing workload: the ones in the GLCD demo
+ *          (demo/07_GLCD.X/main.c) without its delays, plus text, blit,
+ *          widget and sprite scenes, and one screen drawn with each of the
+ *          rectangle strategies. Every scene is run at 12, 16 and 18 bpp
+ *          starting from a freshly initialized display, and the bus cost of
+ *          the scene alone is written as CSV to stdout, one line per scene
+ *          and pixel format.
+ *
+ *          Estimated times are for a PIC at _XTAL_FREQ with the SPI clock at
+ *          FOSC/4, FOSC/16 and FOSC/64. Each byte takes 8 SPI clocks, which
+ *          is 2 * divider instruction cycles, plus SPI_BYTE_OVERHEAD_CYCLES
+ *          instruction cycles of driver code around it (see
+ *          spi_byte_cycles). The results don't depend on the host, so the
+ *          CSV can be committed and compared against after changing the
+ *          driver
+ * @{
+ */
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include "../../src/GLCD/GLCD_PIC.h"
+#include "../../src/GLCD/GLCD_Font.h"
+#include "../../src/GLCD/GLCD_DrawList.h"
+#include "../../src/GLCD/GLCD_Band.h"
+#include "../../src/GLCD/GLCD_Widget.h"
+#include "../../src/GLCD/GLCD_Sprite.h"
+#include "../../src/SPI/SPI_PIC.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/********************************** Macros ***********************************/
+/** @brief Side of the square image used by the blit scenes */
+#define BENCH_IMAGE_SIZE 32
+
+/********************************** Types ************************************/
+/** @brief A benchmark scene */
+typedef struct{
+    const char* name;
+    void (*run)(void);
+}bench_scene_t;
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+
+static const unsigned char DIVIDERS[] = {4, 16, 64};
+static const unsigned char FORMATS[] = {12, 16, 18};
+
+// Encoded pixels of the blit image, in the current pixel format
+static unsigned char image[BENCH_IMAGE_SIZE * BENCH_IMAGE_SIZE * 3];
+
+// An 8x8 ball, as palette indices a column at a time
+static const unsigned char BALL_PIXELS[64] = {
+    0, 0, 1, 1, 1, 1, 0, 0,
+    0, 1, 2, 2, 1, 1, 1, 0,
+    1, 2, 2, 1, 1, 1, 1, 1,
+    1, 2, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 1, 1, 1, 1, 0, 0
+};
+static const unsigned long BALL_PALETTE[3] = {0x000000, 0xFF4000, 0xFFFFFF};
+static const sprite_image_t BALL = {BALL_PIXELS, BALL_PALETTE, 8, 8, 0};
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Color of a pixel of the blit image
+ * @param x Column
+ * @param y Row
+ * @return 24-bit color
+ */
+static unsigned long benchImageColor(unsigned char x, unsigned char y){
+    return ((unsigned long)(x * 8) << 16) | ((y * 8) << 8) | ((x ^ y) * 8);
+}
+
+/**
+ * @brief Encodes the blit image in the current pixel format, in the order a
+ *        window is filled
+ */
+static void benchEncodeImage(void){
+    unsigned char pending = 0; // 1 if a 12 bpp pixel is half-written
+    unsigned char* p = image;
+    for(unsigned char x = 0; x < BENCH_IMAGE_SIZE; x++){
+        for(unsigned char y = 0; y < BENCH_IMAGE_SIZE; y++){
+            unsigned char c[3];
+            glcdEncodeColor(benchImageColor(x, y), c);
+            if(glcdGetCOLMOD() == 16){
+                *p++ = c[0];
+                *p++ = c[1];
+            }
+            else if(glcdGetCOLMOD() == 18){
+                *p++ = c[0];
+                *p++ = c[1];
+                *p++ = c[2];
+            }
+            else if(!pending){
+                // First pixel of a pair: B1G1, R1 and half a byte
+                *p++ = c[0] | (c[1] >> 4);
+                *p = c[2];
+                pending = 1;
+            }
+            else{
+                *p++ |= c[0] >> 4;
+                *p++ = c[1] | (c[2] >> 4);
+                pending = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Background of the sprite scene: a checkerboard of 16-pixel squares
+ */
+static unsigned long benchCheckerboard(unsigned char x, unsigned char y){
+    return (((x >> 4) ^ (y >> 4)) & 1) ? 0x404040 : 0x202020;
+}
+
+// The GLCD demo's workloads
+static void sceneFillFull(void){
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, RED);
+}
+
+static void sceneRainbowBars(void){
+    glcdDrawRectangle(0, 18, 0, GLCD_SIZE_VERT, RED);
+    glcdDrawRectangle(18, 36, 0, GLCD_SIZE_VERT, ORANGE);
+    glcdDrawRectangle(36, 54, 0, GLCD_SIZE_VERT, YELLOW);
+    glcdDrawRectangle(54, 72, 0, GLCD_SIZE_VERT, GREEN);
+    glcdDrawRectangle(72, 90, 0, GLCD_SIZE_VERT, BLUE);
+    glcdDrawRectangle(90, 108, 0, GLCD_SIZE_VERT, INDIGO);
+    glcdDrawRectangle(108, 128, 0, GLCD_SIZE_VERT, VIOLET);
+}
+
+static void sceneInversion(void){
+    glcd_invon();
+    glcd_invoff();
+}
+
+static void sceneCornerPixels(void){
+    glcdDrawPixel(0, 0, WHITE);
+    glcdDrawPixel(GLCD_SIZE_HORZ, 0, WHITE);
+    glcdDrawPixel(GLCD_SIZE_HORZ, GLCD_SIZE_VERT, WHITE);
+    glcdDrawPixel(0, GLCD_SIZE_VERT, WHITE);
+}
+
+static void scenePixelMath(void){
+    for(unsigned char x = 0; x < GLCD_SIZE_HORZ; x++){
+        if(x % (GLCD_SIZE_VERT / 16) == 0){
+            glcdDrawPixel(GLCD_SIZE_VERT - (x * 8), (x % 3) * 33, x * 2048);
+        }
+        else{
+            glcdDrawPixel(x, GLCD_SIZE_VERT - x, x * 2048);
+        }
+    }
+}
+
+static void scenePixelPattern(void){
+    for(unsigned char y = 0; y < GLCD_SIZE_VERT; y++){
+        for(unsigned char x = 0; x < GLCD_SIZE_HORZ; x++){
+            glcdDrawPixel(x, y, x * y * 16);
+        }
+    }
+}
+
+static void sceneLineSweep(void){
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, BLACK);
+    for(unsigned char y = 0; y < 5; y++){
+        for(unsigned char x = 0; x < GLCD_SIZE_HORZ; x++){
+            glcdDrawPixel(x, y, WHITE);
+        }
+    }
+}
+
+static void sceneLineRects(void){
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, BLACK);
+    for(unsigned char y = 0; y < 5; y++){
+        glcdDrawRectangle(0, GLCD_SIZE_HORZ, y, y + 1, WHITE);
+    }
+}
+
+static void sceneRotations(void){
+    glcdSetOrigin(ORIGIN_TOP_RIGHT);
+    glcdSetOrigin(ORIGIN_BOTTOM_RIGHT);
+    glcdSetOrigin(ORIGIN_BOTTOM_LEFT);
+    glcdSetOrigin(ORIGIN_TOP_LEFT);
+}
+
+// Text
+static void sceneTextStrings(void){
+    for(unsigned char row = 0; row < 16; row++){
+        glcdDrawString(0, row * FONT_CHAR_HEIGHT, "The quick brown fox ",
+                       WHITE, BLUE);
+    }
+}
+
+static void sceneTextChars(void){
+    static const char TEXT[] = "The quick brown fox ";
+    for(unsigned char row = 0; row < 16; row++){
+        for(unsigned char i = 0; TEXT[i] != '\0'; i++){
+            glcdDrawChar(i * FONT_CHAR_WIDTH, row * FONT_CHAR_HEIGHT, TEXT[i],
+                         WHITE, BLUE);
+        }
+    }
+}
+
+// Blits
+static void sceneBlit(void){
+    benchEncodeImage();
+    for(unsigned char i = 0; i < 4; i++){
+        glcdBlit(i * BENCH_IMAGE_SIZE, 0, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE,
+                 image, BLIT_NORMAL);
+    }
+}
+
+static void sceneBlitRotated(void){
+    static const glcd_blit_transform_e TRANSFORMS[4] = {
+        BLIT_NORMAL, BLIT_ROTATE_90, BLIT_ROTATE_180, BLIT_ROTATE_270
+    };
+    benchEncodeImage();
+    for(unsigned char i = 0; i < 4; i++){
+        glcdBlit(i * BENCH_IMAGE_SIZE, 0, BENCH_IMAGE_SIZE, BENCH_IMAGE_SIZE,
+                 image, TRANSFORMS[i]);
+    }
+}
+
+// Widgets and sprites
+static void sceneWidgets(void){
+    glcd_bar_t bar;
+    glcd_readout_t readout;
+    glcdBarInit(&bar, 8, 120, 40, 52, AXIS_X, 1, GREEN, BLACK);
+    glcdReadoutInit(&readout, 8, 60, 5, WHITE, BLACK);
+    for(unsigned short value = 0; value <= 100; value++){
+        glcdBarSet(&bar, value, 100);
+        glcdReadoutSetNumber(&readout, value);
+    }
+}
+
+static void sceneSprite(void){
+    glcd_sprite_t ball;
+    glcdSpriteInit(&ball, &BALL, benchCheckerboard, 0);
+    for(unsigned char i = 0; i < 60; i++){
+        glcdSpriteMove(&ball, i * 2, 10 + i);
+    }
+    glcdSpriteHide(&ball);
+}
+
+// One screen (a window with a title bar, a frame, and two buttons) drawn
+// with each strategy
+static void sceneOverlapDirect(void){
+    glcdDrawRectangle(0, 128, 0, 128, BLUE);
+    glcdDrawRectangle(8, 120, 8, 120, WHITE);
+    glcdDrawRectangle(10, 118, 22, 118, BLACK);
+    glcdDrawRectangle(8, 120, 8, 20, INDIGO);
+    glcdDrawRectangle(16, 60, 90, 110, GREEN);
+    glcdDrawRectangle(68, 112, 90, 110, RED);
+}
+
+static void sceneOverlapDrawList(void){
+    glcdDrawListRect(0, 128, 0, 128, BLUE);
+    glcdDrawListRect(8, 120, 8, 120, WHITE);
+    glcdDrawListRect(10, 118, 22, 118, BLACK);
+    glcdDrawListRect(8, 120, 8, 20, INDIGO);
+    glcdDrawListRect(16, 60, 90, 110, GREEN);
+    glcdDrawListRect(68, 112, 90, 110, RED);
+    glcdDrawListFlush();
+}
+
+static void sceneOverlapBand(void){
+    glcdBandSetPalette(0, BLUE);
+    glcdBandSetPalette(1, WHITE);
+    glcdBandSetPalette(2, BLACK);
+    glcdBandSetPalette(3, INDIGO);
+    glcdBandSetPalette(4, GREEN);
+    glcdBandSetPalette(5, RED);
+    glcdBandClear();
+    glcdBandRect(8, 120, 8, 120, 1);
+    glcdBandRect(10, 118, 22, 118, 2);
+    glcdBandRect(8, 120, 8, 20, 3);
+    glcdBandRect(16, 60, 90, 110, 4);
+    glcdBandRect(68, 112, 90, 110, 5);
+    glcdBandRender(0, GLCD_SIZE_VERT);
+}
+
+static const bench_scene_t SCENES[] = {
+    {"fill_full", sceneFillFull},
+    {"rainbow_bars", sceneRainbowBars},
+    {"inversion", sceneInversion},
+    {"corner_pixels", sceneCornerPixels},
+    {"pixel_math", scenePixelMath},
+    {"pixel_pattern", scenePixelPattern},
+    {"line_sweep", sceneLineSweep},
+    {"line_rects", sceneLineRects},
+    {"rotations", sceneRotations},
+    {"text_strings", sceneTextStrings},
+    {"text_chars", sceneTextChars},
+    {"blit", sceneBlit},
+    {"blit_rotated", sceneBlitRotated},
+    {"widgets", sceneWidgets},
+    {"sprite", sceneSprite},
+    {"overlap_direct", sceneOverlapDirect},
+    {"overlap_drawlist", sceneOverlapDrawList},
+    {"overlap_band", sceneOverlapBand}
+};
+
+/**
+ * @brief Estimates how long sending some bytes takes on the PIC
+ * @param bytes Bytes sent
+ * @param divider FOSC divider of the SPI clock
+ * @return Microseconds
+ */
+static unsigned long benchEstimateUs(unsigned long bytes, unsigned char divider){
+    unsigned long long cycles =
+        (unsigned long long)bytes * spi_byte_cycles(divider);
+    return (unsigned long)((cycles * 4ULL * 1000000ULL) / _XTAL_FREQ);
+}
+
+/**
+ * @brief Runs a scene on a freshly initialized display and prints its cost
+ * @param scene The scene
+ * @param bpp Interface pixel format
+ */
+static void benchRun(const bench_scene_t* scene, unsigned char bpp){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetCOLMOD(bpp);
+    halLinuxSync();
+    emuResetStats(&emu);
+    
+    scene->run();
+    halLinuxSync();
+    
+    emu_stats_t stats;
+    emuGetStats(&emu, &stats);
+    printf("%s,%u,%lu,%lu,%lu,%lu,%lu,%lu,%lu", scene->name, bpp,
+           stats.bytes, stats.commandBytes, stats.dataBytes, stats.csToggles,
+           stats.windowSetups, stats.pixels, stats.madctlWrites);
+    for(unsigned char i = 0; i < sizeof(DIVIDERS); i++){
+        printf(",%lu", benchEstimateUs(stats.bytes, DIVIDERS[i]));
+    }
+    printf("\n");
+    emuDetach();
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    printf("scene,bpp,bytes,cmd_bytes,data_bytes,cs_toggles,window_setups,"
+           "pixels,madctl_writes,us_fosc4,us_fosc16,us_fosc64\n");
+    for(unsigned char i = 0; i < sizeof(SCENES) / sizeof(SCENES[0]); i++){
+        for(unsigned char j = 0; j < sizeof(FORMATS); j++){
+            benchRun(&SCENES[i], FORMATS[j]);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,204 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup SD_Emu
+ */
+
+/********************************* Includes **********************************/
+#include "SD_Emu.h"
+#include <string.h>
+
+/******************************** Constants **********************************/
+static const unsigned char PIN_CS = 7; /**< RD7 */
+
+// Commands
+static const unsigned char CMD_GO_IDLE_STATE = 0;
+static const unsigned char CMD_SEND_IF_COND = 8;
+static const unsigned char CMD_SET_BLOCKLEN = 16;
+static const unsigned char CMD_READ_SINGLE_BLOCK = 17;
+static const unsigned char CMD_APP_CMD = 55;
+static const unsigned char CMD_READ_OCR = 58;
+static const unsigned char ACMD_SD_SEND_OP_COND = 41;
+
+static const unsigned char R1_IDLE = 0x01;
+static const unsigned char R1_ILLEGAL_COMMAND = 0x04;
+static const unsigned char R1_PARAMETER_ERROR = 0x40;
+
+static const unsigned char DATA_START_TOKEN = 0xFE;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Adds a byte to what the card sends
+ * @param sd The card
+ * @param byte The byte
+ */
+static void sdEmuQueue(sd_emu_t* sd, unsigned char byte){
+    if(sd->outHead + sd->outLen < SD_EMU_MAX_OUTPUT){
+        sd->out[sd->outHead + sd->outLen++] = byte;
+    }
+}
+
+/**
+ * @brief Queues a sector as a data block
+ * @param sd The card
+ * @param sector Number of the sector
+ */
+static void sdEmuQueueSector(sd_emu_t* sd, unsigned long sector){
+    unsigned char data[SD_EMU_SECTOR_SIZE];
+    memset(data, 0, sizeof(data));
+    if(fseek(sd->file, (long)sector * SD_EMU_SECTOR_SIZE, SEEK_SET) == 0){
+        size_t n = fread(data, 1, sizeof(data), sd->file);
+        (void)n; // Past the end of the file, the rest stays 0
+    }
+    
+    sdEmuQueue(sd, 0xFF); // Access time
+    sdEmuQueue(sd, DATA_START_TOKEN);
+    for(unsigned short i = 0; i < SD_EMU_SECTOR_SIZE; i++){
+        sdEmuQueue(sd, data[i]);
+    }
+    sdEmuQueue(sd, 0xFF); // CRC
+    sdEmuQueue(sd, 0xFF);
+    sd->sectorsRead++;
+}
+
+/**
+ * @brief Carries out a command once all of it is received
+ * @param sd The card
+ */
+static void sdEmuCommand(sd_emu_t* sd){
+    unsigned char cmd = sd->cmd[0] & 0x3F;
+    unsigned long arg = ((unsigned long)sd->cmd[1] << 24) |
+                        ((unsigned long)sd->cmd[2] << 16) |
+                        ((unsigned long)sd->cmd[3] << 8) |
+                        sd->cmd[4];
+    unsigned char appCmd = sd->appCmd;
+    sd->appCmd = 0;
+    sd->outHead = 0;
+    sd->outLen = 0;
+    sdEmuQueue(sd, 0xFF); // Response time (NCR)
+    
+    if(appCmd && (cmd == ACMD_SD_SEND_OP_COND)){
+        sd->idle = 0;
+        sdEmuQueue(sd, 0);
+    }
+    else if(cmd == CMD_GO_IDLE_STATE){
+        sd->idle = 1;
+        sdEmuQueue(sd, R1_IDLE);
+    }
+    else if(cmd == CMD_SEND_IF_COND){
+        sdEmuQueue(sd, sd->idle);
+        sdEmuQueue(sd, 0);
+        sdEmuQueue(sd, 0);
+        sdEmuQueue(sd, (arg >> 8) & 0x0F);
+        sdEmuQueue(sd, arg & 0xFF);
+    }
+    else if(cmd == CMD_APP_CMD){
+        sd->appCmd = 1;
+        sdEmuQueue(sd, sd->idle);
+    }
+    else if(cmd == CMD_READ_OCR){
+        sdEmuQueue(sd, sd->idle);
+        sdEmuQueue(sd, sd->idle ? 0x40 : 0xC0); // Powered up, high capacity
+        sdEmuQueue(sd, 0xFF);
+        sdEmuQueue(sd, 0x80);
+        sdEmuQueue(sd, 0x00);
+    }
+    else if(cmd == CMD_SET_BLOCKLEN){
+        sdEmuQueue(sd, (arg == SD_EMU_SECTOR_SIZE) ? 0 : R1_PARAMETER_ERROR);
+    }
+    else if((cmd == CMD_READ_SINGLE_BLOCK) && !sd->idle){
+        sdEmuQueue(sd, 0);
+        sdEmuQueueSector(sd, arg);
+    }
+    else{
+        sdEmuQueue(sd, sd->idle | R1_ILLEGAL_COMMAND);
+    }
+}
+
+static void sdEmuPinWrite(
+    void* ctx,
+    char port,
+    unsigned char bit,
+    unsigned char level
+)
+{
+    sd_emu_t* sd = ctx;
+    if((port == 'D') && (bit == PIN_CS)){
+        level = level ? 1 : 0;
+        if((sd->cs == 1) && (level == 0)){
+            sd->selects++;
+        }
+        sd->cs = level;
+    }
+    if((sd->next != 0) && (sd->next->pinWrite != 0)){
+        sd->next->pinWrite(sd->next->ctx, port, bit, level);
+    }
+}
+
+static unsigned char sdEmuPinRead(void* ctx, char port, unsigned char bit){
+    sd_emu_t* sd = ctx;
+    if((sd->next != 0) && (sd->next->pinRead != 0)){
+        return sd->next->pinRead(sd->next->ctx, port, bit);
+    }
+    return 0;
+}
+
+static unsigned char sdEmuSpiTransfer(void* ctx, unsigned char byte){
+    sd_emu_t* sd = ctx;
+    unsigned char received = 0xFF;
+    if((sd->next != 0) && (sd->next->spiTransfer != 0)){
+        received = sd->next->spiTransfer(sd->next->ctx, byte);
+    }
+    if(sd->cs){
+        return received; // Not driving the data line
+    }
+    
+    // Commands start with 01 in the top bits. 0xFF is sent while waiting
+    if((sd->numCmdBytes > 0) || ((byte & 0xC0) == 0x40)){
+        sd->cmd[sd->numCmdBytes++] = byte;
+        if(sd->numCmdBytes == sizeof(sd->cmd)){
+            sd->numCmdBytes = 0;
+            sdEmuCommand(sd);
+        }
+        return 0xFF;
+    }
+    
+    if(sd->outLen > 0){
+        sd->outLen--;
+        return sd->out[sd->outHead++];
+    }
+    return 0xFF;
+}
+
+/***************************** Public Functions ******************************/
+int sdEmuOpen(sd_emu_t* sd, const char* path){
+    memset(sd, 0, sizeof(*sd));
+    sd->file = fopen(path, "rb");
+    if(sd->file == 0){
+        return -1;
+    }
+    sd->cs = 1;
+    sd->idle = 1;
+    sd->backend.pinWrite = sdEmuPinWrite;
+    sd->backend.pinRead = sdEmuPinRead;
+    sd->backend.spiTransfer = sdEmuSpiTransfer;
+    sd->backend.ctx = sd;
+    return 0;
+}
+
+void sdEmuAttach(sd_emu_t* sd){
+    sd->next = halLinuxGetBackend();
+    halLinuxSetBackend(&sd->backend);
+}
+
+void sdEmuClose(sd_emu_t* sd){
+    if(halLinuxGetBackend() == &sd->backend){
+        halLinuxSetBackend(sd->next);
+    }
+    if(sd->file != 0){
+        fclose(sd->file);
+        sd->file = 0;
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup SD_Emu
+ * @brief Model of an SD card in SPI mode, backed by an image file, for running
+ *        the SD driver on a PC
+ * @details The card behaves as an initialized-on-first-try high capacity card:
+ *          it answers CMD0, CMD8, CMD55/ACMD41, CMD58, CMD16 and CMD17, and
+ *          rejects anything else as an illegal command. Sector n is the
+ *          SD_EMU_SECTOR_SIZE bytes at offset n * SD_EMU_SECTOR_SIZE of the
+ *          file; reads past its end return zeros.
+ *
+ *          The card is put on the bus in front of whatever backend is already
+ *          attached (e.g. an emulated display), wired the way SD_PIC.h
+ *          expects: CS on RD7. Pin changes and SPI bytes are passed on to that
+ *          backend, and the card answers bytes sent while it's selected
+ * @{
+ */
+
+#ifndef SD_EMU_H
+#define SD_EMU_H
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include "../../src/HAL/HAL.h"
+
+/********************************** Macros ***********************************/
+#define SD_EMU_SECTOR_SIZE 512 /**< Bytes in a sector */
+
+/** @brief Most bytes waiting to be sent by the card: a response and a block */
+#define SD_EMU_MAX_OUTPUT (SD_EMU_SECTOR_SIZE + 8)
+
+/********************************** Types ************************************/
+/** @brief State of an emulated card */
+typedef struct{
+    FILE* file;              /**< The card's contents */
+    unsigned char cs;        /**< Chip select level */
+    unsigned char idle;      /**< 1 until ACMD41 */
+    unsigned char appCmd;    /**< 1 after CMD55 */
+    unsigned char cmd[6];    /**< Command being received */
+    unsigned char numCmdBytes;
+    unsigned char out[SD_EMU_MAX_OUTPUT]; /**< Bytes the card will send */
+    unsigned short outHead;
+    unsigned short outLen;
+
+    unsigned long selects;     /**< Times the card was selected */
+    unsigned long sectorsRead; /**< CMD17 commands that returned data */
+
+    const hal_backend_t* next; /**< Backend the bus is passed on to */
+    hal_backend_t backend;
+}sd_emu_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets up an emulated card, as it is after power-up
+ * @param sd The card
+ * @param path Image file holding its contents
+ * @return 0 on success, -1 if the file can't be opened
+ */
+int sdEmuOpen(sd_emu_t* sd, const char* path);
+
+/**
+ * @brief Puts the card on the bus, in front of the backend that's attached
+ *        now. Attach the other devices first
+ * @param sd The card. Must stay valid while attached
+ */
+void sdEmuAttach(sd_emu_t* sd);
+
+/**
+ * @brief Takes the card off the bus, putting back the backend it was in
+ *        front of, and closes its file
+ * @param sd The card
+ */
+void sdEmuClose(sd_emu_t* sd);
+
+/**
+ * @}
+ */
+
+#endif /* SD_EMU_H */
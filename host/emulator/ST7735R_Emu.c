@@ -0,0 +1,469 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup ST7735R_Emu
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "ST7735R_Emu.h"
+
+/******************************** Constants **********************************/
+enum{
+    CMD_SWRESET = 0x01,
+    CMD_SLPIN = 0x10,
+    CMD_SLPOUT = 0x11,
+    CMD_PTLON = 0x12,
+    CMD_NORON = 0x13,
+    CMD_INVOFF = 0x20,
+    CMD_INVON = 0x21,
+    CMD_DISPOFF = 0x28,
+    CMD_DISPON = 0x29,
+    CMD_CASET = 0x2A,
+    CMD_RASET = 0x2B,
+    CMD_RAMWR = 0x2C,
+    CMD_PTLAR = 0x30,
+    CMD_SCRLAR = 0x33,
+    CMD_MADCTL = 0x36,
+    CMD_VSCSAD = 0x37,
+    CMD_IDMOFF = 0x38,
+    CMD_IDMON = 0x39,
+    CMD_COLMOD = 0x3A,
+    CMD_FRMCTR1 = 0xB1
+};
+
+// MADCTL bits
+static const unsigned char MADCTL_MY = 0x80;
+static const unsigned char MADCTL_MX = 0x40;
+static const unsigned char MADCTL_MV = 0x20;
+static const unsigned char MADCTL_RGB = 0x08;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Puts the registers in their reset state. Display RAM is kept
+ * @param emu The emulator
+ */
+static void emuReset(st7735r_emu_t* emu){
+    emu->cmd = 0;
+    emu->numParams = 0;
+    emu->colStart = 0;
+    emu->colEnd = emu->memCols - 1;
+    emu->rowStart = 0;
+    emu->rowEnd = emu->memRows - 1;
+    emu->madctl = 0;
+    emu->bpp = 18;
+    emu->frmctr1[0] = 0x01;
+    emu->frmctr1[1] = 0x2C;
+    emu->frmctr1[2] = 0x2D;
+    emu->partialStart = 0;
+    emu->partialEnd = emu->memRows - 1;
+    emu->tfa = 0;
+    emu->vsa = emu->memRows;
+    emu->bfa = 0;
+    emu->ssa = 0;
+    emu->sleeping = 1;
+    emu->displayOn = 0;
+    emu->inverted = 0;
+    emu->idle = 0;
+    emu->partial = 0;
+    emu->scrolling = 0;
+    emu->col = 0;
+    emu->row = 0;
+    emu->numPixelBytes = 0;
+}
+
+/**
+ * @brief Stores a pixel at the address counters, and advances them
+ * @param emu The emulator
+ * @param c0 First component sent (6 bits)
+ * @param c1 Second component sent (6 bits)
+ * @param c2 Third component sent (6 bits)
+ */
+static void emuPutPixel(
+    st7735r_emu_t* emu,
+    unsigned char c0,
+    unsigned char c1,
+    unsigned char c2
+)
+{
+    // Row addresses select panel rows unless MV exchanges them with columns
+    int memRow, memCol;
+    if(emu->madctl & MADCTL_MV){
+        memRow = emu->col;
+        memCol = emu->row;
+    }
+    else{
+        memRow = emu->row;
+        memCol = emu->col;
+    }
+    if(emu->madctl & MADCTL_MX){
+        memCol = (emu->memCols - 1) - memCol;
+    }
+    if(emu->madctl & MADCTL_MY){
+        memRow = (emu->memRows - 1) - memRow;
+    }
+    
+    if((memRow >= 0) && (memRow < emu->memRows) &&
+       (memCol >= 0) && (memCol < emu->memCols)){
+        emu->mem[memRow][memCol][0] = c0;
+        emu->mem[memRow][memCol][1] = c1;
+        emu->mem[memRow][memCol][2] = c2;
+        if(emu->pixelHook != 0){
+            emu->pixelHook(emu->pixelHookCtx, memRow, memCol);
+        }
+    }
+    emu->stats.pixels++;
+    
+    // The column address increments first, and both wrap within the window
+    if(emu->col >= emu->colEnd){
+        emu->col = emu->colStart;
+        emu->row = (emu->row >= emu->rowEnd) ? emu->rowStart : emu->row + 1;
+    }
+    else{
+        emu->col++;
+    }
+}
+
+/**
+ * @brief Decodes pixel data received after RAMWR
+ * @param emu The emulator
+ * @param byte The next byte of pixel data
+ */
+static void emuPixelData(st7735r_emu_t* emu, unsigned char byte){
+    unsigned char* b = emu->pixelBytes;
+    b[emu->numPixelBytes++] = byte;
+    
+    switch(emu->bpp){
+        case 12:
+            // Two pixels in three bytes: C0C1, C2C0', C1'C2'. Expand each
+            // 4-bit component to 6 bits
+            if(emu->numPixelBytes == 2){
+                emuPutPixel(
+                    emu,
+                    (b[0] >> 2) & 0x3C,
+                    (b[0] << 2) & 0x3C,
+                    (b[1] >> 2) & 0x3C
+                );
+            }
+            else if(emu->numPixelBytes == 3){
+                emuPutPixel(
+                    emu,
+                    (b[1] << 2) & 0x3C,
+                    (b[2] >> 2) & 0x3C,
+                    (b[2] << 2) & 0x3C
+                );
+                emu->numPixelBytes = 0;
+            }
+            break;
+        case 16:
+            // 5-6-5, with the 5-bit components widened to 6 bits
+            if(emu->numPixelBytes == 2){
+                emuPutPixel(
+                    emu,
+                    (b[0] >> 2) & 0x3E,
+                    ((b[0] << 3) & 0x38) | (b[1] >> 5),
+                    (b[1] << 1) & 0x3E
+                );
+                emu->numPixelBytes = 0;
+            }
+            break;
+        default:
+            // One byte per component, upper 6 bits used
+            if(emu->numPixelBytes == 3){
+                emuPutPixel(emu, b[0] >> 2, b[1] >> 2, b[2] >> 2);
+                emu->numPixelBytes = 0;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Acts on a command once enough parameters have arrived
+ * @param emu The emulator
+ */
+static void emuParams(st7735r_emu_t* emu){
+    const unsigned char* p = emu->params;
+    switch(emu->cmd){
+        case CMD_CASET:
+            if(emu->numParams == 4){
+                emu->colStart = (p[0] << 8) | p[1];
+                emu->colEnd = (p[2] << 8) | p[3];
+            }
+            break;
+        case CMD_RASET:
+            if(emu->numParams == 4){
+                emu->rowStart = (p[0] << 8) | p[1];
+                emu->rowEnd = (p[2] << 8) | p[3];
+            }
+            break;
+        case CMD_PTLAR:
+            if(emu->numParams == 4){
+                emu->partialStart = (p[0] << 8) | p[1];
+                emu->partialEnd = (p[2] << 8) | p[3];
+            }
+            break;
+        case CMD_SCRLAR:
+            if(emu->numParams == 6){
+                emu->tfa = (p[0] << 8) | p[1];
+                emu->vsa = (p[2] << 8) | p[3];
+                emu->bfa = (p[4] << 8) | p[5];
+            }
+            break;
+        case CMD_VSCSAD:
+            if(emu->numParams == 2){
+                emu->ssa = (p[0] << 8) | p[1];
+                emu->scrolling = 1;
+            }
+            break;
+        case CMD_MADCTL:
+            if(emu->numParams == 1){
+                emu->madctl = p[0];
+            }
+            break;
+        case CMD_FRMCTR1:
+            if(emu->numParams == 3){
+                emu->frmctr1[0] = p[0];
+                emu->frmctr1[1] = p[1];
+                emu->frmctr1[2] = p[2];
+            }
+            break;
+        case CMD_COLMOD:
+            if(emu->numParams == 1){
+                switch(p[0] & 0x07){
+                    case 3:
+                        emu->bpp = 12;
+                        break;
+                    case 5:
+                        emu->bpp = 16;
+                        break;
+                    default:
+                        emu->bpp = 18;
+                        break;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Starts a command
+ * @param emu The emulator
+ * @param cmd The command
+ */
+static void emuCommand(st7735r_emu_t* emu, unsigned char cmd){
+    emu->cmd = cmd;
+    emu->numParams = 0;
+    emu->numPixelBytes = 0;
+    
+    switch(cmd){
+        case CMD_SWRESET:
+            emuReset(emu);
+            break;
+        case CMD_SLPIN:
+            emu->sleeping = 1;
+            break;
+        case CMD_SLPOUT:
+            emu->sleeping = 0;
+            break;
+        case CMD_PTLON:
+            emu->partial = 1;
+            break;
+        case CMD_NORON:
+            emu->partial = 0;
+            emu->scrolling = 0;
+            break;
+        case CMD_INVOFF:
+            emu->inverted = 0;
+            break;
+        case CMD_INVON:
+            emu->inverted = 1;
+            break;
+        case CMD_DISPOFF:
+            emu->displayOn = 0;
+            break;
+        case CMD_DISPON:
+            emu->displayOn = 1;
+            break;
+        case CMD_RAMWR:
+            emu->col = emu->colStart;
+            emu->row = emu->rowStart;
+            emu->stats.windowSetups++;
+            break;
+        case CMD_MADCTL:
+            emu->stats.madctlWrites++;
+            break;
+        case CMD_COLMOD:
+            emu->stats.colmodWrites++;
+            break;
+        case CMD_IDMOFF:
+            emu->idle = 0;
+            break;
+        case CMD_IDMON:
+            emu->idle = 1;
+            break;
+        default:
+            break;
+    }
+}
+
+/***************************** Public Functions ******************************/
+void emuInit(st7735r_emu_t* emu, emu_panel_e panel){
+    memset(emu, 0, sizeof(*emu));
+    // Display RAM is 132 x 162 or 128 x 160, as set by the controller's GM
+    // pins. Where the 128 x 128 panel sits in it depends on how the module
+    // connects the panel to the source and gate outputs (see emu_panel_e)
+    if(panel == EMU_PANEL_V1_1){
+        emu->memCols = 132;
+        emu->memRows = 162;
+        emu->colOrigin = 2;
+        emu->rowOrigin = 1;
+    }
+    else{
+        emu->memCols = 128;
+        emu->memRows = 160;
+        emu->colOrigin = 0;
+        emu->rowOrigin = 0;
+    }
+    emu->cs = 1;
+    emu->rs = 1;
+    emuReset(emu);
+}
+
+void emuSetCS(st7735r_emu_t* emu, unsigned char level){
+    level = level ? 1 : 0;
+    if((emu->cs == 1) && (level == 0)){
+        emu->stats.csToggles++;
+    }
+    emu->cs = level;
+}
+
+void emuSetRS(st7735r_emu_t* emu, unsigned char level){
+    emu->rs = level ? 1 : 0;
+}
+
+void emuWrite(st7735r_emu_t* emu, unsigned char byte){
+    if(emu->cs){
+        return;
+    }
+    
+    emu->stats.bytes++;
+    if(emu->rs == 0){
+        emu->stats.commandBytes++;
+        emuCommand(emu, byte);
+        return;
+    }
+    
+    emu->stats.dataBytes++;
+    if(emu->cmd == CMD_RAMWR){
+        emuPixelData(emu, byte);
+    }
+    else if(emu->numParams < EMU_MAX_PARAMS){
+        emu->params[emu->numParams++] = byte;
+        emuParams(emu);
+    }
+}
+
+unsigned long emuGetPanelPixel(
+    const st7735r_emu_t* emu,
+    unsigned char col,
+    unsigned char row
+)
+{
+    if(emu->sleeping || !emu->displayOn){
+        return 0xFFFFFF; // Normally white panel with nothing driven
+    }
+    
+    int memCol = emu->colOrigin + col;
+    int scanRow = emu->rowOrigin + row;
+    if(emu->partial &&
+       ((scanRow < emu->partialStart) || (scanRow > emu->partialEnd))){
+        return 0x000000; // Non-display area
+    }
+    
+    // The scroll area is the rows of display RAM between the fixed areas,
+    // since the datasheet has TFA + VSA + BFA add up to the row count. Scan
+    // rows inside it show display RAM starting from SSA, wrapping around
+    // within the area
+    int memRow = scanRow;
+    int area = emu->memRows - emu->tfa - emu->bfa;
+    if(emu->scrolling && (area > 0) &&
+       (scanRow >= emu->tfa) && (scanRow < emu->tfa + area)){
+        int line = (scanRow - emu->tfa) + (emu->ssa - emu->tfa);
+        memRow = emu->tfa + ((line % area) + area) % area;
+    }
+    if((memRow >= emu->memRows) || (memCol >= emu->memCols)){
+        return 0x000000;
+    }
+    
+    unsigned char c[3];
+    for(int i = 0; i < 3; i++){
+        unsigned char v = emu->mem[memRow][memCol][i];
+        if(emu->idle){
+            v = (v & 0x20) ? 0x3F : 0;
+        }
+        if(emu->inverted){
+            v = 0x3F - v;
+        }
+        c[i] = (v << 2) | (v >> 4); // 6 bits to 8
+    }
+    
+    // The panel's subpixels are in BGR order, so the first component sent
+    // is blue unless MADCTL swaps the order
+    if(emu->madctl & MADCTL_RGB){
+        return ((unsigned long)c[0] << 16) | ((unsigned long)c[1] << 8) | c[2];
+    }
+    return ((unsigned long)c[2] << 16) | ((unsigned long)c[1] << 8) | c[0];
+}
+
+unsigned short emuGetFrameLines(const st7735r_emu_t* emu){
+    return emu->memRows + emu->frmctr1[1] + emu->frmctr1[2] + 2;
+}
+
+int emuWritePPM(const st7735r_emu_t* emu, const char* path){
+    FILE* f = fopen(path, "wb");
+    if(f == NULL){
+        return -1;
+    }
+    
+    // The panel is mounted with its first column and row at the bottom right,
+    // which is why the driver mirrors both for ORIGIN_TOP_LEFT
+    fprintf(f, "P6\n%d %d\n255\n", EMU_PANEL_SIZE, EMU_PANEL_SIZE);
+    for(int row = EMU_PANEL_SIZE - 1; row >= 0; row--){
+        for(int col = EMU_PANEL_SIZE - 1; col >= 0; col--){
+            unsigned long color = emuGetPanelPixel(emu, col, row);
+            fputc((color >> 16) & 0xFF, f);
+            fputc((color >> 8) & 0xFF, f);
+            fputc(color & 0xFF, f);
+        }
+    }
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+void emuSetPixelHook(st7735r_emu_t* emu, emu_pixel_hook_t hook, void* ctx){
+    emu->pixelHook = hook;
+    emu->pixelHookCtx = ctx;
+}
+
+void emuGetStats(const st7735r_emu_t* emu, emu_stats_t* stats){
+    *stats = emu->stats;
+}
+
+void emuResetStats(st7735r_emu_t* emu){
+    memset(&emu->stats, 0, sizeof(emu->stats));
+}
+
+void emuPrintStats(const st7735r_emu_t* emu, FILE* stream){
+    const emu_stats_t* s = &emu->stats;
+    fprintf(stream, "bytes:         %lu\n", s->bytes);
+    fprintf(stream, "command bytes: %lu\n", s->commandBytes);
+    fprintf(stream, "data bytes:    %lu\n", s->dataBytes);
+    fprintf(stream, "window setups: %lu\n", s->windowSetups);
+    fprintf(stream, "CS toggles:    %lu\n", s->csToggles);
+    fprintf(stream, "pixels:        %lu\n", s->pixels);
+    fprintf(stream, "MADCTL writes: %lu\n", s->madctlWrites);
+    fprintf(stream, "COLMOD writes: %lu\n", s->colmodWrites);
+}
@@ -0,0 +1,219 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup ST7735R_Emu
+ * @brief Model of the ST7735R display controller, for running the driver on a
+ *        PC
+ * @details Consumes the chip select, register select and byte stream that the
+ *          driver puts on the bus, and keeps a model of the controller's
+ *          132 x 162 display data RAM. Modeled:
+ *           - CASET/RASET windows, and the RAMWR address counters, which
+ *             increment along the column address first and wrap around
+ *             within the window
+ *           - MADCTL row/column exchange and mirroring (MV, MX, MY), and the
+ *             RGB order bit
+ *           - COLMOD 12, 16 and 18 bits per pixel
+ *           - INVON/INVOFF, IDMON/IDMOFF, DISPON/DISPOFF, SLPIN/SLPOUT
+ *           - SCRLAR/VSCSAD vertical scrolling and PTLAR/PTLON partial mode
+ *           - FRMCTR1, which is only recorded, so that the frame timing can
+ *             be worked out (see emuGetFrameLines and ST7735R_EmuBackend.h)
+ *
+ *          Other commands are accepted and their parameters ignored.
+ *
+ *          Addresses map to display RAM as in the datasheet: with MV = 1, row
+ *          addresses select RAM columns and column addresses RAM rows, and MX
+ *          and MY mirror them across all of display RAM's columns and rows,
+ *          not just those the panel shows. The panel shows a 128 x 128 part
+ *          of display RAM, placed as listed in emu_panel_e, counting from
+ *          RAM column and row 0 with MX = MY = 0. Vertical scrolling wraps
+ *          within the rows of display RAM left between the fixed areas.
+ *
+ *          What the panel shows can be read back a pixel at a time or saved
+ *          as a PPM image, and bus statistics are kept so the cost of a
+ *          drawing path can be measured
+ * @{
+ */
+
+#ifndef ST7735R_EMU_H
+#define ST7735R_EMU_H
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+
+/********************************** Macros ***********************************/
+#define EMU_MEM_COLS 132 /**< Columns in the largest display RAM layout */
+#define EMU_MEM_ROWS 162 /**< Rows in the largest display RAM layout */
+#define EMU_PANEL_SIZE 128 /**< Panel width and height, in pixels */
+#define EMU_MAX_PARAMS 16 /**< Command parameters kept */
+
+/********************************** Types ************************************/
+/** @brief The panel versions the driver supports */
+typedef enum{
+    EMU_PANEL_V1_1, /**< 132 x 162 display RAM, panel at column 2, row 1 */
+    EMU_PANEL_V2_1  /**< 128 x 160 display RAM, panel at column 0, row 0 */
+}emu_panel_e;
+
+/** @brief Bus statistics */
+typedef struct{
+    unsigned long bytes;        /**< Bytes sent while selected */
+    unsigned long commandBytes; /**< Bytes sent with RS low */
+    unsigned long dataBytes;    /**< Bytes sent with RS high */
+    unsigned long windowSetups; /**< RAMWR commands */
+    unsigned long csToggles;    /**< Times the controller was selected */
+    unsigned long pixels;       /**< Pixels written to display RAM */
+    unsigned long madctlWrites; /**< MADCTL commands */
+    unsigned long colmodWrites; /**< COLMOD commands */
+}emu_stats_t;
+
+/**
+ * @brief Called for each pixel stored in display RAM, e.g. by analysis tools
+ * @param ctx The context given to emuSetPixelHook
+ * @param memRow Display RAM row
+ * @param memCol Display RAM column
+ */
+typedef void (*emu_pixel_hook_t)(
+    void* ctx,
+    unsigned short memRow,
+    unsigned short memCol
+);
+
+/** @brief State of an emulated controller and panel */
+typedef struct{
+    // Display RAM, 3 components of 6 bits per pixel, in the order they're
+    // sent (which the panel shows as blue, green, red when MADCTL RGB = 0)
+    unsigned char mem[EMU_MEM_ROWS][EMU_MEM_COLS][3];
+    unsigned char memCols;   /**< Columns in the display RAM layout */
+    unsigned char memRows;   /**< Rows in the display RAM layout */
+    unsigned char colOrigin; /**< First display RAM column on the panel */
+    unsigned char rowOrigin; /**< First display RAM row on the panel */
+    
+    // Bus
+    unsigned char cs;         /**< Chip select level */
+    unsigned char rs;         /**< Register select level (0 --> command) */
+    unsigned char cmd;        /**< Command being received */
+    unsigned char params[EMU_MAX_PARAMS];
+    unsigned char numParams;
+    
+    // Registers
+    unsigned short colStart, colEnd; /**< CASET */
+    unsigned short rowStart, rowEnd; /**< RASET */
+    unsigned char madctl;
+    unsigned char bpp;
+    unsigned char frmctr1[3]; /**< FRMCTR1: RTNA, FPA, BPA */
+    unsigned short partialStart, partialEnd; /**< PTLAR */
+    unsigned short tfa, vsa, bfa; /**< SCRLAR */
+    unsigned short ssa;           /**< VSCSAD */
+    unsigned char sleeping;
+    unsigned char displayOn;
+    unsigned char inverted;
+    unsigned char idle;
+    unsigned char partial;
+    unsigned char scrolling;
+    
+    // RAMWR
+    unsigned short col, row; /**< Address counters */
+    unsigned char pixelBytes[3]; /**< Bytes of the pixel(s) being received */
+    unsigned char numPixelBytes;
+    
+    emu_stats_t stats;
+    emu_pixel_hook_t pixelHook;
+    void* pixelHookCtx;
+}st7735r_emu_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets up an emulated controller as it is after a hardware reset, with
+ *        its display RAM cleared to black
+ * @param emu The emulator
+ * @param panel The panel version, which sets the display RAM layout
+ */
+void emuInit(st7735r_emu_t* emu, emu_panel_e panel);
+
+/**
+ * @brief Drives the chip select line
+ * @param emu The emulator
+ * @param level 0 selects the controller
+ */
+void emuSetCS(st7735r_emu_t* emu, unsigned char level);
+
+/**
+ * @brief Drives the register select line
+ * @param emu The emulator
+ * @param level 0 for commands, 1 for parameters and pixel data
+ */
+void emuSetRS(st7735r_emu_t* emu, unsigned char level);
+
+/**
+ * @brief Clocks a byte into the controller. Ignored unless selected
+ * @param emu The emulator
+ * @param byte The byte
+ */
+void emuWrite(st7735r_emu_t* emu, unsigned char byte);
+
+/**
+ * @brief Gets the color the panel shows at a pixel, taking scrolling,
+ *        partial mode, idle mode, inversion and the display being off into
+ *        account
+ * @param emu The emulator
+ * @param col Panel column (0 to EMU_PANEL_SIZE - 1)
+ * @param row Panel row (0 to EMU_PANEL_SIZE - 1)
+ * @return 24-bit color, 0xRRGGBB
+ */
+unsigned long emuGetPanelPixel(
+    const st7735r_emu_t* emu,
+    unsigned char col,
+    unsigned char row
+);
+
+/**
+ * @brief Gets the number of lines in a frame: the display RAM rows, and the
+ *        front and back porches set with FRMCTR1 plus 2
+ * @param emu The emulator
+ * @return Lines per frame
+ */
+unsigned short emuGetFrameLines(const st7735r_emu_t* emu);
+
+/**
+ * @brief Saves what the panel shows as a binary PPM image, the way up it is
+ *        seen (so that ORIGIN_TOP_LEFT is at the top left of the image)
+ * @param emu The emulator
+ * @param path File to write
+ * @return 0 on success, -1 if the file couldn't be written
+ */
+int emuWritePPM(const st7735r_emu_t* emu, const char* path);
+
+/**
+ * @brief Sets a function to be called for each pixel stored in display RAM
+ * @param emu The emulator
+ * @param hook The function, or 0 for none
+ * @param ctx Passed to the function
+ */
+void emuSetPixelHook(st7735r_emu_t* emu, emu_pixel_hook_t hook, void* ctx);
+
+/**
+ * @brief Gets the bus statistics
+ * @param emu The emulator
+ * @param stats Where to put the statistics
+ */
+void emuGetStats(const st7735r_emu_t* emu, emu_stats_t* stats);
+
+/**
+ * @brief Resets the bus statistics, e.g. at the start of a frame
+ * @param emu The emulator
+ */
+void emuResetStats(st7735r_emu_t* emu);
+
+/**
+ * @brief Prints the bus statistics
+ * @param emu The emulator
+ * @param stream Where to print them
+ */
+void emuPrintStats(const st7735r_emu_t* emu, FILE* stream);
+
+/**
+ * @}
+ */
+
+#endif /* ST7735R_EMU_H */
@@ -0,0 +1,130 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup ST7735R_Emu
+ */
+
+/********************************* Includes **********************************/
+#include "ST7735R_EmuBackend.h"
+#include "../../src/HAL/HAL.h"
+
+/******************************** Constants **********************************/
+static const unsigned char PIN_CS = 0; /**< RD0 */
+static const unsigned char PIN_RS = 1; /**< RD1 */
+static const unsigned char PIN_TE = 2; /**< RD2 */
+
+/********************************** Types ************************************/
+/**
+ * @brief The emulators on the bus, the pins of their chip selects, and the
+ *        scan of the first one
+ */
+typedef struct{
+    st7735r_emu_t* emus[EMU_MAX_PANELS];
+    unsigned char csPins[EMU_MAX_PANELS];
+    unsigned char count;
+    double lines;              /**< Lines scanned up to since */
+    unsigned long long since;  /**< Simulated time of the last update */
+    double lineCycles;         /**< Instruction cycles per line from since */
+}emu_bus_t;
+
+/***************************** Private Variables *****************************/
+static emu_bus_t bus;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Brings the scan of the first emulator up to the simulated time, and
+ *        takes up its current line period from then on
+ */
+static void emuScan(void){
+    unsigned long long now = halLinuxGetCycles();
+    if(bus.lineCycles > 0){
+        bus.lines += (now - bus.since) / bus.lineCycles;
+    }
+    bus.since = now;
+    bus.lineCycles = (bus.count == 0) ? 0 :
+        (bus.emus[0]->frmctr1[0] * 2.0 + 40.0) * (_XTAL_FREQ / 4.0) /
+        EMU_PANEL_FOSC;
+}
+
+static void emuPinWrite(
+    void* ctx,
+    char port,
+    unsigned char bit,
+    unsigned char level
+)
+{
+    emu_bus_t* bus = ctx;
+    if(port != 'D'){
+        return;
+    }
+    for(unsigned char i = 0; i < bus->count; i++){
+        if(bit == bus->csPins[i]){
+            emuSetCS(bus->emus[i], level);
+        }
+        else if(bit == PIN_RS){
+            emuSetRS(bus->emus[i], level);
+        }
+    }
+}
+
+static unsigned char emuPinRead(void* ctx, char port, unsigned char bit){
+    emu_bus_t* bus = ctx;
+    if((port == 'D') && (bit == PIN_TE) && (bus->count > 0)){
+        const st7735r_emu_t* emu = bus->emus[0];
+        unsigned long line = emuGetScanLines() % emuGetFrameLines(emu);
+        return line >= emu->memRows; // Vertical blanking
+    }
+    return 0;
+}
+
+static unsigned char emuSpiTransfer(void* ctx, unsigned char byte){
+    // Each controller ignores the byte unless it's selected
+    emu_bus_t* bus = ctx;
+    for(unsigned char i = 0; i < bus->count; i++){
+        emuWrite(bus->emus[i], byte);
+    }
+    emuScan(); // In case the byte changed the line period
+    return 0xFF; // The controller's data line is never read
+}
+
+/***************************** Private Variables *****************************/
+static hal_backend_t emuBackend = {
+    emuPinWrite,
+    emuPinRead,
+    emuSpiTransfer,
+    &bus
+};
+
+/***************************** Public Functions ******************************/
+void emuAttach(st7735r_emu_t* emu){
+    const unsigned char csPin = PIN_CS;
+    emuAttachPanels(&emu, &csPin, 1);
+}
+
+void emuAttachPanels(
+    st7735r_emu_t* const* emus,
+    const unsigned char* csPins,
+    unsigned char count
+)
+{
+    bus.count = (count < EMU_MAX_PANELS) ? count : EMU_MAX_PANELS;
+    for(unsigned char i = 0; i < bus.count; i++){
+        bus.emus[i] = emus[i];
+        bus.csPins[i] = csPins[i];
+    }
+    bus.lines = 0;
+    bus.lineCycles = 0;
+    emuScan();
+    halLinuxSetBackend(&emuBackend);
+}
+
+void emuDetach(void){
+    halLinuxSetBackend(0);
+}
+
+unsigned long long emuGetScanLines(void){
+    emuScan();
+    return (unsigned long long)bus.lines;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup ST7735R_Emu
+ * @brief Connects an emulated controller to the Linux hardware abstraction,
+ *        wired the way GLCD_PIC.h expects: CS on RD0, RS on RD1 and TE on RD2
+ * @details TE follows the controller's scan, which is modeled from the
+ *          simulated time and the FRMCTR1 parameters received: one line every
+ *          RTNA * 2 + 40 clocks of the EMU_PANEL_FOSC oscillator, and
+ *          emuGetFrameLines lines per frame. Display RAM row n is scanned on
+ *          line n of each frame, and TE is high (vertical blanking) for the
+ *          lines after the last row. New parameters take effect from the
+ *          byte that completes them
+ */
+
+#ifndef ST7735R_EMUBACKEND_H
+#define ST7735R_EMUBACKEND_H
+
+/********************************* Includes **********************************/
+#include "ST7735R_Emu.h"
+
+/********************************** Macros ***********************************/
+/** @brief Frequency of the controller's oscillator, in Hz */
+#define EMU_PANEL_FOSC 850000UL
+
+/** @brief Most emulators that can share the bus */
+#define EMU_MAX_PANELS 4
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Makes an emulator the destination of the driver's pins and SPI
+ *        bytes, replacing any other backend
+ * @param emu The emulator. Must stay valid while attached
+ */
+void emuAttach(st7735r_emu_t* emu);
+
+/**
+ * @brief Connects several emulators to the bus, for multi-panel setups (see
+ *        glcdSelectPanel). They share RS, TE (RD2, as seen by the first) and
+ *        the SPI bus, and each has its own chip select
+ * @param emus The emulators. Must stay valid while attached
+ * @param csPins The port D bit of each one's chip select
+ * @param count Number of emulators (max: EMU_MAX_PANELS)
+ */
+void emuAttachPanels(
+    st7735r_emu_t* const* emus,
+    const unsigned char* csPins,
+    unsigned char count
+);
+
+/** @brief Disconnects the emulator */
+void emuDetach(void);
+
+/**
+ * @brief Gets how far the scan of the first emulator on the bus has got
+ * @return Lines scanned since it was attached
+ */
+unsigned long long emuGetScanLines(void);
+
+#endif /* ST7735R_EMUBACKEND_H */
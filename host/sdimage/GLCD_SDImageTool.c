@@ -0,0 +1,292 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_SDImageTool
+ * @brief Makes SD card images for glcdDrawSDImage, and shows how they're drawn
+ * @details Two commands:
+ *           - encode converts a binary PPM (P6, 8 bits per component, at most
+ *             255 x 255) into an image in the format described in
+ *             GLCD_SDImage.h. The PPM's columns are along x and its rows
+ *             along y. The result can be written to a card at any sector,
+ *             e.g. with dd, or used directly as a card's contents
+ *           - show runs the driver against the emulated display and an
+ *             emulated card backed by the given file, draws the image at
+ *             sector 0 with glcdDrawSDImage, saves what the panel shows as a
+ *             PPM, and prints the bus cost, including how many times each
+ *             device was selected
+ *
+ *          Usage:
+ *          @code
+ *          glcd_sdimage encode [-f raw16|raw18|rle16] in.ppm out.img
+ *          glcd_sdimage show [-n sectors] [-x x] [-y y] in.img out.ppm
+ *          @endcode
+ *          -f defaults to rle16, -n (sectors read at a time) to 1
+ * @{
+ */
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../src/GLCD/GLCD_SDImage.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+#include "../emulator/SD_Emu.h"
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Reads a binary PPM
+ * @param path File to read
+ * @param width Where to put the width
+ * @param height Where to put the height
+ * @return The pixels, 3 bytes each, row by row, or NULL on error
+ */
+static unsigned char* toolReadPPM(
+    const char* path,
+    unsigned* width,
+    unsigned* height
+)
+{
+    FILE* f = fopen(path, "rb");
+    if(f == NULL){
+        perror(path);
+        return NULL;
+    }
+    unsigned maxval;
+    unsigned char* pixels = NULL;
+    if((fscanf(f, "P6 %u %u %u", width, height, &maxval) == 3) &&
+       (fgetc(f) != EOF) && (maxval == 255) &&
+       (*width > 0) && (*width <= 255) && (*height > 0) && (*height <= 255))
+    {
+        size_t size = (size_t)*width * *height * 3;
+        pixels = malloc(size);
+        if((pixels != NULL) && (fread(pixels, 1, size, f) != size)){
+            free(pixels);
+            pixels = NULL;
+        }
+    }
+    if(pixels == NULL){
+        fprintf(stderr, "%s: not a PPM of at most 255 x 255 pixels\n", path);
+    }
+    fclose(f);
+    return pixels;
+}
+
+/**
+ * @brief Converts a pixel to the bytes sent for it at 16 bpp (see
+ *        glcdEncodeColor)
+ * @param rgb The pixel's red, green and blue
+ * @param data Where to put the 2 bytes
+ */
+static void toolEncode16(const unsigned char* rgb, unsigned char* data){
+    data[0] = (rgb[2] & 0xF8) | (rgb[1] >> 5);
+    data[1] = ((rgb[1] << 3) & 0xE0) | (rgb[0] >> 3);
+}
+
+/**
+ * @brief Converts a PPM into an SD image
+ * @param format The format to store the pixels in
+ * @param in PPM to read
+ * @param out Image to write
+ * @return 0 on success, otherwise 1
+ */
+static int toolEncode(
+    glcd_sdimage_format_e format,
+    const char* in,
+    const char* out
+)
+{
+    unsigned width, height;
+    unsigned char* pixels = toolReadPPM(in, &width, &height);
+    if(pixels == NULL){
+        return 1;
+    }
+    FILE* f = fopen(out, "wb");
+    if(f == NULL){
+        perror(out);
+        free(pixels);
+        return 1;
+    }
+    
+    unsigned char header[SDIMAGE_HEADER_SIZE] = {
+        'G', 'I', format, width, height, 0, 0, 0
+    };
+    fwrite(header, 1, sizeof(header), f);
+    
+    // A column at a time, in the order a window is filled
+    unsigned char run[3] = {0, 0, 0};
+    for(unsigned x = 0; x < width; x++){
+        for(unsigned y = 0; y < height; y++){
+            const unsigned char* rgb = &pixels[(y * width + x) * 3];
+            unsigned char data[3];
+            if(format == SDIMAGE_RAW18){
+                data[0] = rgb[2];
+                data[1] = rgb[1];
+                data[2] = rgb[0];
+                fwrite(data, 1, 3, f);
+                continue;
+            }
+            toolEncode16(rgb, data);
+            if(format == SDIMAGE_RAW16){
+                fwrite(data, 1, 2, f);
+            }
+            else if((run[0] > 0) && (run[0] < 255) &&
+                    (data[0] == run[1]) && (data[1] == run[2]))
+            {
+                run[0]++;
+            }
+            else{
+                if(run[0] > 0){
+                    fwrite(run, 1, 3, f);
+                }
+                run[0] = 1;
+                run[1] = data[0];
+                run[2] = data[1];
+            }
+        }
+    }
+    if(run[0] > 0){
+        fwrite(run, 1, 3, f);
+    }
+    
+    long size = ftell(f);
+    free(pixels);
+    if(fclose(f) != 0){
+        perror(out);
+        return 1;
+    }
+    printf("%u x %u pixels, %ld bytes, %ld sectors\n", width, height, size,
+           (size + SD_SECTOR_SIZE - 1) / SD_SECTOR_SIZE);
+    return 0;
+}
+
+/**
+ * @brief Draws an SD image on the emulated display
+ * @param in Image to read, as the contents of the emulated card
+ * @param out Where to save what the panel shows
+ * @param x x-position of the image
+ * @param y y-position of the image
+ * @param numSectors Sectors read at a time
+ * @return 0 on success, otherwise 1
+ */
+static int toolShow(
+    const char* in,
+    const char* out,
+    unsigned char x,
+    unsigned char y,
+    unsigned char numSectors
+)
+{
+    static st7735r_emu_t emu;
+    static sd_emu_t sd;
+    static unsigned char buf[SDIMAGE_MAX_SECTORS * SD_SECTOR_SIZE];
+    if(sdEmuOpen(&sd, in) != 0){
+        perror(in);
+        return 1;
+    }
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    sdEmuAttach(&sd);
+    
+    initGLCD();
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    if(!sdInit()){
+        fprintf(stderr, "%s: card initialization failed\n", in);
+        sdEmuClose(&sd);
+        return 1;
+    }
+    
+    emuResetStats(&emu);
+    sd.selects = 0;
+    sd.sectorsRead = 0;
+    unsigned long long start = halLinuxGetCycles();
+    unsigned char success = glcdDrawSDImage(x, y, 0, buf, numSectors);
+    unsigned long long cycles = halLinuxGetCycles() - start;
+    sdEmuClose(&sd);
+    if(!success){
+        fprintf(stderr, "%s: not a valid image, or it doesn't fit\n", in);
+        return 1;
+    }
+    
+    emuPrintStats(&emu, stdout);
+    printf("sectors read:  %lu\n", sd.sectorsRead);
+    printf("SD selects:    %lu\n", sd.selects);
+    printf("time (us):     %.0f\n", cycles * 4e6 / _XTAL_FREQ);
+    if(emuWritePPM(&emu, out) != 0){
+        perror(out);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Prints how to use the tool
+ * @param name Name the tool was run as
+ * @return Exit status for a usage error
+ */
+static int toolUsage(const char* name){
+    fprintf(stderr,
+            "usage: %s encode [-f raw16|raw18|rle16] in.ppm out.img\n"
+            "       %s show [-n sectors] [-x x] [-y y] in.img out.ppm\n",
+            name, name);
+    return 2;
+}
+
+/***************************** Public Functions ******************************/
+int main(int argc, char* argv[]){
+    if(argc < 2){
+        return toolUsage(argv[0]);
+    }
+    
+    glcd_sdimage_format_e format = SDIMAGE_RLE16;
+    unsigned long numSectors = 1, x = 0, y = 0;
+    const char* paths[2] = {NULL, NULL};
+    unsigned char numPaths = 0;
+    for(int i = 2; i < argc; i++){
+        if((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)){
+            i++;
+            if(strcmp(argv[i], "raw16") == 0){
+                format = SDIMAGE_RAW16;
+            }
+            else if(strcmp(argv[i], "raw18") == 0){
+                format = SDIMAGE_RAW18;
+            }
+            else if(strcmp(argv[i], "rle16") != 0){
+                return toolUsage(argv[0]);
+            }
+        }
+        else if((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)){
+            numSectors = strtoul(argv[++i], NULL, 0);
+        }
+        else if((strcmp(argv[i], "-x") == 0) && (i + 1 < argc)){
+            x = strtoul(argv[++i], NULL, 0);
+        }
+        else if((strcmp(argv[i], "-y") == 0) && (i + 1 < argc)){
+            y = strtoul(argv[++i], NULL, 0);
+        }
+        else if((argv[i][0] != '-') && (numPaths < 2)){
+            paths[numPaths++] = argv[i];
+        }
+        else{
+            return toolUsage(argv[0]);
+        }
+    }
+    if(numPaths != 2){
+        return toolUsage(argv[0]);
+    }
+    
+    if(strcmp(argv[1], "encode") == 0){
+        return toolEncode(format, paths[0], paths[1]);
+    }
+    if((strcmp(argv[1], "show") == 0) && (numSectors >= 1) &&
+       (numSectors <= SDIMAGE_MAX_SECTORS) && (x <= 255) && (y <= 255))
+    {
+        return toolShow(paths[0], paths[1], x, y, numSectors);
+    }
+    return toolUsage(argv[0]);
+}
+
+/**
+ * @}
+ */
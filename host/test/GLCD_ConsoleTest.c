@@ -0,0 +1,213 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks what a new line costs once the console is full
+ * @details At the origins that scroll along y, a new line must only send the
+ *          line that is blanked (one window of a line of cells) and the
+ *          VSCSAD command that scrolls it into place, with no repaint of the
+ *          lines already on screen. What the panel shows is checked too: every
+ *          line moves up by one, and the new bottom line is blank.
+ *
+ *          Starting the console again at an origin that scrolls along x must
+ *          cancel the scrolling, so that drawing lands where it would on a
+ *          display that never scrolled
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_Console.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+static const unsigned char BPPS[] = {12, 16, 18};
+static const glcd_origin_positions_e ORIGINS[] = {
+    ORIGIN_TOP_LEFT, ORIGIN_BOTTOM_RIGHT
+};
+
+static const glcd_origin_positions_e X_ORIGINS[] = {
+    ORIGIN_TOP_RIGHT, ORIGIN_BOTTOM_LEFT
+};
+
+static const unsigned char NUM_SCROLLS = 20; /**< More than CONSOLE_ROWS */
+static const unsigned long MARK_COLOR = 0xF0F000;
+static const unsigned char VSCSAD_BYTES = 3; /**< Command and 2 parameters */
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static glcd_origin_positions_e origin; /**< Origin being tested */
+static unsigned long before[EMU_PANEL_SIZE][EMU_PANEL_SIZE];
+static unsigned long unscrolled[EMU_PANEL_SIZE][EMU_PANEL_SIZE];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Fills the current line with a character
+ * @param c The character
+ */
+static void testFillLine(char c){
+    char line[CONSOLE_COLS + 1];
+    memset(line, c, CONSOLE_COLS);
+    line[CONSOLE_COLS] = '\0';
+    glcdConsolePuts(line);
+    glcdConsoleFlush();
+}
+
+/**
+ * @brief Gets what the panel shows at a position, in display coordinates
+ * @param x x-position
+ * @param y y-position
+ * @return 24-bit color
+ */
+static unsigned long testGetPixel(unsigned char x, unsigned char y){
+    // ORIGIN_BOTTOM_RIGHT is panel row and column 0, so ORIGIN_TOP_LEFT is
+    // the panel the other way up
+    if(origin == ORIGIN_TOP_LEFT){
+        x = (EMU_PANEL_SIZE - 1) - x;
+        y = (EMU_PANEL_SIZE - 1) - y;
+    }
+    return emuGetPanelPixel(&emu, x, y);
+}
+
+/**
+ * @brief Scrolls the console by a line several times, checking the cost and
+ *        what the panel shows each time
+ * @param bpp Interface pixel format
+ */
+static void testScroll(unsigned char bpp){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetCOLMOD(bpp);
+    glcdSetOrigin(origin);
+    glcdConsoleInit();
+    TEST_CHECK(glcdGetScrollAxis() == AXIS_Y, "origin %u: no hardware scroll",
+               origin);
+    
+    // Fill every line, so that each new line scrolls
+    for(unsigned char row = 0; row < CONSOLE_ROWS; row++){
+        if(row > 0){
+            glcdConsolePutc('\n');
+        }
+        testFillLine('A' + row);
+    }
+    
+    unsigned long linePixels =
+        (unsigned long)CONSOLE_COLS * FONT_CHAR_WIDTH * FONT_CHAR_HEIGHT;
+    unsigned long pixelBytes = (bpp == 12) ? (linePixels * 3 + 1) / 2 :
+                               linePixels * ((bpp == 16) ? 2 : 3);
+    unsigned long lineBytes = GLCD_WINDOW_SETUP_BYTES + pixelBytes +
+                              VSCSAD_BYTES;
+    unsigned char lineHeight = CONSOLE_ROWS * FONT_CHAR_HEIGHT;
+    for(unsigned char i = 0; i < NUM_SCROLLS; i++){
+        for(unsigned char y = 0; y < lineHeight; y++){
+            for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+                before[y][x] = testGetPixel(x, y);
+            }
+        }
+        
+        emuResetStats(&emu);
+        glcdConsolePutc('\n');
+        glcdConsoleFlush();
+        emu_stats_t stats;
+        emuGetStats(&emu, &stats);
+        TEST_CHECK((stats.pixels == linePixels) && (stats.bytes == lineBytes),
+                   "%u bpp, origin %u: new line took %lu pixels and %lu bytes"
+                   " (expected %lu and %lu)", bpp, origin, stats.pixels,
+                   stats.bytes, linePixels, lineBytes);
+        
+        // Everything moves up a line, and the bottom line is blank
+        unsigned long mismatches = 0;
+        for(unsigned char y = 0; y < lineHeight; y++){
+            for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+                unsigned char below = y + FONT_CHAR_HEIGHT;
+                unsigned long want = (below < lineHeight) ?
+                                     before[below][x] : 0x000000;
+                if(testGetPixel(x, y) != want){
+                    mismatches++;
+                }
+            }
+        }
+        TEST_CHECK(mismatches == 0, "%u bpp, origin %u, scroll %u: %lu pixels"
+                   " wrong", bpp, origin, i, mismatches);
+        
+        testFillLine('a' + i);
+    }
+}
+
+/**
+ * @brief Starts the console at an origin that scrolls along x, and draws a
+ *        square in its corner
+ * @param xOrigin The origin
+ * @param panel Where to save what the panel shows
+ */
+static void testRestart(
+    glcd_origin_positions_e xOrigin,
+    unsigned long panel[EMU_PANEL_SIZE][EMU_PANEL_SIZE]
+)
+{
+    glcdSetOrigin(xOrigin);
+    glcdConsoleInit();
+    glcdDrawRectangle(0, 10, 0, 10, MARK_COLOR);
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            panel[y][x] = emuGetPanelPixel(&emu, x, y);
+        }
+    }
+}
+
+/**
+ * @brief Scrolls the console, then starts it again at an origin that scrolls
+ *        along x, checking that the scroll offset is gone
+ * @param xOrigin The origin to start again at
+ */
+static void testScrollCancelled(glcd_origin_positions_e xOrigin){
+    // What the panel shows without any scrolling beforehand
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    testRestart(xOrigin, unscrolled);
+    
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetOrigin(origin);
+    glcdConsoleInit();
+    for(unsigned char row = 0; row < NUM_SCROLLS + CONSOLE_ROWS; row++){
+        glcdConsolePutc('\n');
+        testFillLine('A' + (row & 0x0F));
+    }
+    TEST_CHECK(emu.scrolling && (emu.ssa != emu.tfa),
+               "origin %u: console didn't scroll", origin);
+    
+    testRestart(xOrigin, before);
+    TEST_CHECK(glcdGetScrollAxis() == AXIS_X, "origin %u scrolls along y",
+               xOrigin);
+    TEST_CHECK(!emu.scrolling, "origin %u, then %u: still scrolling (SSA %u)",
+               origin, xOrigin, emu.ssa);
+    TEST_CHECK(memcmp(before, unscrolled, sizeof(before)) == 0,
+               "origin %u, then %u: panel differs from one that never "
+               "scrolled", origin, xOrigin);
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    for(unsigned char i = 0; i < sizeof(BPPS); i++){
+        for(unsigned char j = 0; j < sizeof(ORIGINS) / sizeof(ORIGINS[0]); j++){
+            origin = ORIGINS[j];
+            testScroll(BPPS[i]);
+        }
+    }
+    
+    unsigned char numX = sizeof(X_ORIGINS) / sizeof(X_ORIGINS[0]);
+    for(unsigned char i = 0; i < sizeof(ORIGINS) / sizeof(ORIGINS[0]); i++){
+        for(unsigned char j = 0; j < numX; j++){
+            origin = ORIGINS[i];
+            testScrollCancelled(X_ORIGINS[j]);
+        }
+    }
+    
+    return TEST_RESULT("console");
+}
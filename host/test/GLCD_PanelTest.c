@@ -0,0 +1,216 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that several displays on one bus are driven independently,
+ *        and together when broadcasting
+ * @details Three emulators share the bus, each with its own chip select. They
+ *          are initialized and given a header together, then each is set to
+ *          its own pixel format and origin and drawn to on its own, going
+ *          back and forth between them. Each must end up looking like a
+ *          single display that was sent only its own drawing. Then, with
+ *          the displays' settings differing, settings sent to all of them at
+ *          once must reach every one, even those whose setting the first
+ *          display already has
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_PIC.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+#define NUM_PANELS 3
+
+static const unsigned char CS_PINS[NUM_PANELS] = {0, 3, 4};
+static const unsigned char BPPS[NUM_PANELS] = {18, 16, 12};
+static const glcd_origin_positions_e ORIGINS[NUM_PANELS] = {
+    ORIGIN_TOP_LEFT, ORIGIN_BOTTOM_LEFT, ORIGIN_TOP_RIGHT
+};
+static const unsigned long COLORS[NUM_PANELS] = {
+    0xFF0000, 0x00FF00, 0x0000FF
+};
+
+static const unsigned long HEADER_COLOR = 0xFFFF00;
+static const unsigned char HEADER_HEIGHT = 16;
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emus[NUM_PANELS];
+static glcd_panel_t panels[NUM_PANELS];
+static unsigned long expected[NUM_PANELS][EMU_PANEL_SIZE][EMU_PANEL_SIZE];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Draws the header, which every display shows
+ */
+static void testDrawHeader(void){
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, HEADER_HEIGHT, HEADER_COLOR);
+}
+
+/**
+ * @brief Sets up a display the way only it is set up
+ * @param i Which display
+ */
+static void testSetUp(unsigned char i){
+    glcdSetCOLMOD(BPPS[i]);
+    glcdSetOrigin(ORIGINS[i]);
+}
+
+/**
+ * @brief Draws the first or second rectangle that only one display shows
+ * @param i Which display
+ * @param second 1 for the second rectangle
+ */
+static void testDrawOwn(unsigned char i, unsigned char second){
+    unsigned char x = 10 + 30 * i + 5 * second;
+    unsigned char y = 30 + 20 * second;
+    glcdDrawRectangle(x, x + 40, y, y + 25, COLORS[i] >> second);
+}
+
+/**
+ * @brief Gets what each display should look like, by drawing the same thing
+ *        on a single display of its own
+ */
+static void testMakeExpected(void){
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        st7735r_emu_t ref;
+        emuInit(&ref, EMU_PANEL_V1_1);
+        emuAttach(&ref);
+        initGLCD();
+        testDrawHeader();
+        testSetUp(i);
+        testDrawOwn(i, 0);
+        testDrawOwn(i, 1);
+        for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+            for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+                expected[i][y][x] = emuGetPanelPixel(&ref, x, y);
+            }
+        }
+        emuDetach();
+    }
+}
+
+/**
+ * @brief Counts the pixels a display shows differently from what's expected
+ * @param i Which display
+ * @return The number of pixels
+ */
+static unsigned long testMismatches(unsigned char i){
+    unsigned long mismatches = 0;
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            if(emuGetPanelPixel(&emus[i], x, y) != expected[i][y][x]){
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Checks that setting up the handles deselects every display, so none
+ *        of them listens while another is initialized
+ */
+static void testHandles(void){
+    // What the latches and data direction could be after power-on
+    LATD = 0x00;
+    TRISD = 0xFF;
+    
+    unsigned char masks = 0;
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        glcdInitPanel(&panels[i], 1 << CS_PINS[i], GLCD_PANEL_V1_1);
+        masks |= 1 << CS_PINS[i];
+    }
+    TEST_CHECK((LATD & masks) == masks, "chip selects not driven high: LATD "
+               "0x%02X", LATD);
+    TEST_CHECK((TRISD & masks) == 0, "chip selects not outputs: TRISD 0x%02X",
+               TRISD);
+}
+
+/**
+ * @brief Draws on the displays together and one at a time, and checks that
+ *        each shows only what was meant for it
+ */
+static void testDrawing(void){
+    glcd_panel_t* const all[NUM_PANELS] = {&panels[0], &panels[1], &panels[2]};
+    
+    glcdSelectPanels(all, NUM_PANELS);
+    initGLCD();
+    testDrawHeader();
+    
+    // One at a time, and then again, so each display's settings must be
+    // brought back when it is selected
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        glcdSelectPanel(&panels[i]);
+        testSetUp(i);
+        testDrawOwn(i, 0);
+    }
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        glcdSelectPanel(&panels[i]);
+        testDrawOwn(i, 1);
+    }
+    
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        unsigned long mismatches = testMismatches(i);
+        TEST_CHECK(mismatches == 0, "display %u: %lu pixels look different",
+                   i, mismatches);
+    }
+}
+
+/**
+ * @brief Checks that settings broadcast while the displays disagree reach
+ *        all of them
+ */
+static void testBroadcast(void){
+    glcd_panel_t* const all[NUM_PANELS] = {&panels[0], &panels[1], &panels[2]};
+    
+    glcdSelectPanel(&panels[1]);
+    glcd_invon();
+    
+    // The first display already has all of these
+    glcdSelectPanels(all, NUM_PANELS);
+    glcdSetCOLMOD(BPPS[0]);
+    glcdSetOrigin(ORIGINS[0]);
+    glcd_invoff();
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    glcdDrawRectangle(20, 70, 40, 100, 0x808080);
+    
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        TEST_CHECK(emus[i].bpp == BPPS[0], "display %u at %u bpp", i,
+                   emus[i].bpp);
+        TEST_CHECK(emus[i].madctl == emus[0].madctl, "display %u has MADCTL "
+                   "0x%02X, not 0x%02X", i, emus[i].madctl, emus[0].madctl);
+        TEST_CHECK(!emus[i].inverted, "display %u still inverted", i);
+        TEST_CHECK(memcmp(emus[i].mem, emus[0].mem, sizeof(emus[0].mem)) == 0,
+                   "display %u shows something else", i);
+    }
+    
+    // The settings are kept for each display, and not sent again when it's
+    // selected on its own
+    glcdSelectPanel(&panels[1]);
+    unsigned long madctlWrites = emus[1].stats.madctlWrites;
+    glcdSetOrigin(ORIGINS[0]);
+    TEST_CHECK(emus[1].stats.madctlWrites == madctlWrites,
+               "MADCTL sent again to display 1");
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    testMakeExpected();
+    testHandles();
+    
+    st7735r_emu_t* const attached[NUM_PANELS] = {&emus[0], &emus[1], &emus[2]};
+    for(unsigned char i = 0; i < NUM_PANELS; i++){
+        emuInit(&emus[i], EMU_PANEL_V1_1);
+    }
+    emuAttachPanels(attached, CS_PINS, NUM_PANELS);
+    
+    testDrawing();
+    testBroadcast();
+    
+    return TEST_RESULT("panel");
+}
@@ -0,0 +1,164 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that the command queue draws the same as the blocking drawing
+ *        functions
+ * @details The MSSP interrupt is simulated: the simulated bus finishes each
+ *          transfer at once and raises SSPIF, and the queue's waits call
+ *          glcdQueueServiceISR through halPoll while mssp_int_pending() is
+ *          true. The same scene of rectangles, text and a blit is drawn
+ *          through the queue and directly at 12, 16 and 18 bpp, and the
+ *          display RAM must come out the same. Through the queue, the second
+ *          buffer is recorded while the first is still being sent, and then
+ *          enough is recorded that glcdQueueSubmit has to wait for a buffer
+ *          to come free, again and again. Odd pixel counts check that 12 bpp
+ *          pairs are completed within each record
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_Queue.h"
+#include "../../src/SPI/SPI_PIC.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+static const unsigned char BPPS[] = {12, 16, 18};
+
+static const char TEXT[] = "Queue 123";
+static const unsigned long TEXT_FG = 0xFFFFFF;
+static const unsigned long TEXT_BG = 0x204080;
+
+// Blit window. 15 pixels, which is an odd number
+static const unsigned char BLIT_XS = 70;
+static const unsigned char BLIT_XE = 73;
+static const unsigned char BLIT_YS = 5;
+static const unsigned char BLIT_YE = 10;
+
+/** @brief Rectangles drawn after the blit: more than both buffers hold */
+static const unsigned char NUM_FILL_RECTS = 40;
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static unsigned char blitData[45]; /**< Enough for 15 pixels at 18 bpp */
+static unsigned char expected[EMU_MEM_ROWS][EMU_MEM_COLS][3];
+static unsigned long isrCalls; /**< Transfers the interrupt handled */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Finds the size of the blit's data in the interface pixel format
+ * @return Bytes
+ */
+static unsigned short testBlitBytes(void){
+    unsigned short numPixels = (BLIT_XE - BLIT_XS) * (BLIT_YE - BLIT_YS);
+    unsigned char bpp = glcdGetCOLMOD();
+    if(bpp == 12){
+        return numPixels + ((numPixels + 1) >> 1);
+    }
+    return numPixels * ((bpp == 16) ? 2 : 3);
+}
+
+/**
+ * @brief Stands in for the interrupt handler, called by halPoll
+ */
+static void testISR(void){
+    if(mssp_int_pending()){
+        isrCalls++;
+        glcdQueueServiceISR();
+    }
+}
+
+/**
+ * @brief Draws a rectangle through the queue or directly
+ * @param queued 1 to draw through the queue, 0 directly
+ */
+static void testRect(
+    unsigned char queued,
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+)
+{
+    if(queued){
+        glcdQueueRect(XS, XE, YS, YE, color);
+    }
+    else{
+        glcdDrawRectangle(XS, XE, YS, YE, color);
+    }
+}
+
+/**
+ * @brief Resets the display, and draws the scene
+ * @param bpp Interface pixel format
+ * @param queued 1 to draw through the queue, 0 directly
+ */
+static void testDrawScene(unsigned char bpp, unsigned char queued){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetCOLMOD(bpp);
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    isrCalls = 0;
+    
+    testRect(queued, 10, 60, 20, 90, 0x3080F0);
+    testRect(queued, 0, 3, 0, 3, 0xF01010);
+    if(queued){
+        glcdQueueText(4, 100, TEXT, TEXT_FG, TEXT_BG);
+        glcdQueueSubmit();
+        TEST_CHECK(glcdQueueIsBusy(), "%u bpp: first buffer not in flight",
+                   bpp);
+        
+        // Recorded into the other buffer while the first is being sent
+        glcdQueueBlit(BLIT_XS, BLIT_XE, BLIT_YS, BLIT_YE, blitData);
+        TEST_CHECK(glcdQueueIsBusy() && (isrCalls == 0),
+                   "%u bpp: recording waited for the buffer in flight", bpp);
+    }
+    else{
+        glcdDrawString(4, 100, TEXT, TEXT_FG, TEXT_BG);
+        if(glcdSetWindow(BLIT_XS, BLIT_XE, BLIT_YS, BLIT_YE)){
+            glcdWriteData(blitData, testBlitBytes());
+            glcdEndPixels();
+        }
+    }
+    
+    // Overlapping, with odd sizes, so the order they're sent in matters
+    for(unsigned char i = 0; i < NUM_FILL_RECTS; i++){
+        unsigned char x = (i * 7) % 100;
+        unsigned char y = (i * 13) % 110;
+        testRect(queued, x, x + 1 + i % 5, y, y + 3 + i % 4,
+                 0x102030UL * (i + 1));
+    }
+    
+    if(queued){
+        TEST_CHECK(isrCalls > 0, "%u bpp: recording never waited for a "
+                   "buffer to come free", bpp);
+        glcdQueueFence();
+        TEST_CHECK(!glcdQueueIsBusy(), "%u bpp: queue still busy", bpp);
+        halLinuxSync(); // Pass the chip select change on to the emulator
+        TEST_CHECK(emu.cs == 1, "%u bpp: display left selected", bpp);
+    }
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    halLinuxSetISR(testISR);
+    for(unsigned char i = 0; i < sizeof(blitData); i++){
+        blitData[i] = i * 37 + 11;
+    }
+    
+    for(unsigned char i = 0; i < sizeof(BPPS); i++){
+        testDrawScene(BPPS[i], 0);
+        memcpy(expected, emu.mem, sizeof(expected));
+        testDrawScene(BPPS[i], 1);
+        TEST_CHECK(memcmp(expected, emu.mem, sizeof(expected)) == 0,
+                   "%u bpp: queued scene differs from the direct one",
+                   BPPS[i]);
+    }
+    
+    return TEST_RESULT("queue");
+}
@@ -0,0 +1,94 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that glcdRecover brings back what the panel showed
+ * @details The display is set up with a non-default profile, pixel format and
+ *          origin, and scrolled part of the way. After the controller's
+ *          registers are lost (a software reset the driver doesn't know
+ *          about), glcdRecover with GLCD_RECOVER_RESET must leave the panel
+ *          showing the same image, scrolled to the same place
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_PIC.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+static const unsigned char SWRESET = 0x01;
+static const unsigned char SCROLL_LINE = 40;
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static unsigned long before[EMU_PANEL_SIZE][EMU_PANEL_SIZE];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Resets the emulated controller behind the driver's back
+ */
+static void testGlitch(void){
+    emuSetCS(&emu, 0);
+    emuSetRS(&emu, 0);
+    emuWrite(&emu, SWRESET);
+    emuSetCS(&emu, 1);
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetProfile(GLCD_PROFILE_LOW_POWER);
+    glcdSetCOLMOD(16);
+    glcdSetOrigin(ORIGIN_BOTTOM_RIGHT);
+    glcdSetPartialFrameRate(3, 4, 5);
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000040);
+    glcdDrawRectangle(10, 50, 20, 90, 0xF0F000);
+    glcdEnableScroll();
+    glcdScrollTo(SCROLL_LINE);
+    
+    glcd_state_t good;
+    glcdSaveState(&good);
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            before[y][x] = emuGetPanelPixel(&emu, x, y);
+        }
+    }
+    st7735r_emu_t expected = emu;
+    
+    testGlitch();
+    TEST_CHECK(!emu.scrolling, "reset didn't stop scrolling");
+    glcdRecover(&good, GLCD_RECOVER_RESET);
+    
+    TEST_CHECK(emu.scrolling && (emu.ssa == expected.ssa) &&
+               (emu.tfa == expected.tfa) && (emu.vsa == expected.vsa) &&
+               (emu.bfa == expected.bfa), "scroll not restored: SSA %u, "
+               "TFA %u, VSA %u, BFA %u", emu.ssa, emu.tfa, emu.vsa, emu.bfa);
+    TEST_CHECK(memcmp(emu.frmctr1, expected.frmctr1, 3) == 0,
+               "FRMCTR1 not restored");
+    TEST_CHECK((emu.madctl == expected.madctl) && (emu.bpp == expected.bpp),
+               "MADCTL or COLMOD not restored");
+    
+    unsigned long mismatches = 0;
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            if(emuGetPanelPixel(&emu, x, y) != before[y][x]){
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK(mismatches == 0, "%lu pixels look different", mismatches);
+    
+    // Resyncing a display that is already right leaves it scrolling
+    glcdRecover(&good, GLCD_RECOVER_RESYNC);
+    glcdForceResync();
+    glcdScrollTo(SCROLL_LINE);
+    TEST_CHECK(emu.scrolling && (emu.ssa == expected.ssa),
+               "resync changed the scroll");
+    
+    return TEST_RESULT("recover");
+}
@@ -0,0 +1,347 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that glcdDrawSDImage draws images from the emulated card the
+ *        way they were stored
+ * @details An image made of runs of random length and color is stored on the
+ *          card in each format, and drawn reading 1 and 4 sectors at a time.
+ *          The panel must show the same as when the image's pixels are drawn
+ *          one by one, the card must be read a chunk at a time, and the
+ *          interface pixel format must be put back. The image is big enough
+ *          that RLE records are split between chunks. Images with a run of 0
+ *          pixels or that don't fit on the display must be turned down, and
+ *          so must reading more than SDIMAGE_MAX_SECTORS at a time
+ */
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_SDImage.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+#include "../emulator/SD_Emu.h"
+
+/******************************** Constants **********************************/
+#define IMAGE_WIDTH 100
+#define IMAGE_HEIGHT 120
+#define MAX_CHUNK_SECTORS 4
+
+static const unsigned char IMAGE_X = 10;
+static const unsigned char IMAGE_Y = 5;
+static const unsigned long IMAGE_SECTOR = 3; /**< Where it is on the card */
+
+static const glcd_sdimage_format_e FORMATS[] = {
+    SDIMAGE_RAW16, SDIMAGE_RAW18, SDIMAGE_RLE16
+};
+static const unsigned char CHUNK_SECTORS[] = {1, MAX_CHUNK_SECTORS};
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static sd_emu_t sd;
+static char path[] = "/tmp/glcd_sdimage_XXXXXX";
+
+static unsigned long source[IMAGE_WIDTH][IMAGE_HEIGHT];
+static unsigned long expected[EMU_PANEL_SIZE][EMU_PANEL_SIZE];
+
+/** @brief The image as stored, header included */
+static unsigned char image[SDIMAGE_HEADER_SIZE +
+                           IMAGE_WIDTH * IMAGE_HEIGHT * 3];
+static unsigned long imageSize;
+
+static unsigned char buf[MAX_CHUNK_SECTORS * SD_SECTOR_SIZE];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Gets the next pseudo-random number, the same on every run
+ * @return A number from 0 to 32767
+ */
+static unsigned short testRandom(void){
+    static unsigned long state = 1;
+    state = state * 1103515245UL + 12345UL;
+    return (state >> 16) & 0x7FFF;
+}
+
+/**
+ * @brief Fills the source image with runs of random colors, mostly short and
+ *        now and then longer than an RLE record can hold. Runs go on from one
+ *        column to the next, in the order a window is filled
+ */
+static void testMakeSource(void){
+    unsigned long color = 0;
+    unsigned short runLeft = 0;
+    for(unsigned char x = 0; x < IMAGE_WIDTH; x++){
+        for(unsigned char y = 0; y < IMAGE_HEIGHT; y++){
+            if(runLeft == 0){
+                color = ((unsigned long)testRandom() << 9) ^ testRandom();
+                color &= 0xFFFFFF;
+                runLeft = (testRandom() % 128 == 0) ? 300 :
+                          1 + testRandom() % 8;
+            }
+            source[x][y] = color;
+            runLeft--;
+        }
+    }
+}
+
+/**
+ * @brief Converts a color to the bytes sent for it at 16 bpp (see
+ *        glcdEncodeColor)
+ * @param color 24-bit color
+ * @param data Where to put the 2 bytes
+ */
+static void testEncode16(unsigned long color, unsigned char* data){
+    unsigned char red = color >> 16;
+    unsigned char green = color >> 8;
+    unsigned char blue = color;
+    data[0] = (blue & 0xF8) | (green >> 5);
+    data[1] = ((green << 3) & 0xE0) | (red >> 3);
+}
+
+/**
+ * @brief Stores the source image in a format, the way the SD image tool does
+ * @param format How to store the pixels
+ */
+static void testEncode(glcd_sdimage_format_e format){
+    unsigned char header[SDIMAGE_HEADER_SIZE] = {
+        'G', 'I', format, IMAGE_WIDTH, IMAGE_HEIGHT, 0, 0, 0
+    };
+    memcpy(image, header, sizeof(header));
+    imageSize = sizeof(header);
+    
+    unsigned char run[3] = {0, 0, 0};
+    for(unsigned char x = 0; x < IMAGE_WIDTH; x++){
+        for(unsigned char y = 0; y < IMAGE_HEIGHT; y++){
+            unsigned long color = source[x][y];
+            unsigned char data[2];
+            if(format == SDIMAGE_RAW18){
+                image[imageSize++] = color;
+                image[imageSize++] = color >> 8;
+                image[imageSize++] = color >> 16;
+                continue;
+            }
+            testEncode16(color, data);
+            if(format == SDIMAGE_RAW16){
+                image[imageSize++] = data[0];
+                image[imageSize++] = data[1];
+            }
+            else if((run[0] > 0) && (run[0] < 255) &&
+                    (data[0] == run[1]) && (data[1] == run[2]))
+            {
+                run[0]++;
+            }
+            else{
+                if(run[0] > 0){
+                    memcpy(&image[imageSize], run, 3);
+                    imageSize += 3;
+                }
+                run[0] = 1;
+                run[1] = data[0];
+                run[2] = data[1];
+            }
+        }
+    }
+    if(run[0] > 0){
+        memcpy(&image[imageSize], run, 3);
+        imageSize += 3;
+    }
+}
+
+/**
+ * @brief Writes the image to the card file at IMAGE_SECTOR, and puts the
+ *        display and the card on the bus, both just initialized
+ */
+static void testStart(void){
+    FILE* f = fopen(path, "wb");
+    if(f != NULL){
+        fseek(f, IMAGE_SECTOR * SD_SECTOR_SIZE, SEEK_SET);
+        fwrite(image, 1, imageSize, f);
+        fclose(f);
+    }
+    
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    TEST_CHECK(sdEmuOpen(&sd, path) == 0, "can't open %s", path);
+    sdEmuAttach(&sd);
+    initGLCD();
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    TEST_CHECK(sdInit(), "card initialization failed");
+    
+    emuResetStats(&emu);
+    sd.selects = 0;
+    sd.sectorsRead = 0;
+}
+
+/**
+ * @brief Counts the pixels the panel shows differently from expected
+ * @return The number of pixels
+ */
+static unsigned long testMismatches(void){
+    unsigned long mismatches = 0;
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            if(emuGetPanelPixel(&emu, x, y) != expected[y][x]){
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Gets what the panel should show after drawing the image, by drawing
+ *        its pixels one by one at the depth it's stored in
+ * @param format How the image is stored
+ */
+static void testMakeExpected(glcd_sdimage_format_e format){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    glcdSetCOLMOD((format == SDIMAGE_RAW18) ? 18 : 16);
+    for(unsigned char x = 0; x < IMAGE_WIDTH; x++){
+        for(unsigned char y = 0; y < IMAGE_HEIGHT; y++){
+            glcdDrawPixel(IMAGE_X + x, IMAGE_Y + y, source[x][y]);
+        }
+    }
+    for(unsigned char y = 0; y < EMU_PANEL_SIZE; y++){
+        for(unsigned char x = 0; x < EMU_PANEL_SIZE; x++){
+            expected[y][x] = emuGetPanelPixel(&emu, x, y);
+        }
+    }
+    emuDetach();
+}
+
+/**
+ * @brief Draws the image stored in a format, and checks what the panel shows
+ *        and how the card was read
+ * @param format How the image is stored
+ * @param numSectors Sectors read at a time
+ */
+static void testDraw(glcd_sdimage_format_e format, unsigned char numSectors){
+    testEncode(format);
+    testMakeExpected(format);
+    testStart();
+    
+    unsigned char bpp = glcdGetCOLMOD();
+    unsigned char success = glcdDrawSDImage(
+        IMAGE_X, IMAGE_Y, IMAGE_SECTOR, buf, numSectors
+    );
+    sdEmuClose(&sd);
+    
+    unsigned long chunkBytes = (unsigned long)numSectors * SD_SECTOR_SIZE;
+    unsigned long numChunks = (imageSize + chunkBytes - 1) / chunkBytes;
+    unsigned long mismatches = testMismatches();
+    TEST_CHECK(success, "format %u, %u sectors: not drawn", format,
+               numSectors);
+    TEST_CHECK(mismatches == 0, "format %u, %u sectors: %lu pixels look "
+               "different", format, numSectors, mismatches);
+    TEST_CHECK(sd.selects == numChunks, "format %u, %u sectors: card "
+               "selected %lu times for %lu chunks", format, numSectors,
+               sd.selects, numChunks);
+    TEST_CHECK(sd.sectorsRead == numChunks * numSectors, "format %u, %u "
+               "sectors: %lu sectors read", format, numSectors,
+               sd.sectorsRead);
+    TEST_CHECK(emu.stats.windowSetups == 1, "format %u, %u sectors: window "
+               "set %lu times", format, numSectors, emu.stats.windowSetups);
+    TEST_CHECK((glcdGetCOLMOD() == bpp) && (emu.bpp == bpp), "format %u, %u "
+               "sectors: pixel format not put back", format, numSectors);
+}
+
+/**
+ * @brief Checks that the RLE image has a record split between chunks, so
+ *        that putting it back together is tested
+ * @param numSectors Sectors read at a time
+ */
+static void testRecordSplit(unsigned char numSectors){
+    unsigned long chunkBytes = (unsigned long)numSectors * SD_SECTOR_SIZE;
+    unsigned char split = 0;
+    for(unsigned long i = SDIMAGE_HEADER_SIZE; i + 2 < imageSize; i += 3){
+        if(i / chunkBytes != (i + 2) / chunkBytes){
+            split = 1;
+        }
+    }
+    TEST_CHECK(split, "%u sectors: no RLE record split between chunks",
+               numSectors);
+}
+
+/**
+ * @brief Checks that a run of 0 pixels stops the drawing, in the chunk it's
+ *        found in
+ */
+static void testZeroRun(void){
+    testEncode(SDIMAGE_RLE16);
+    
+    // A record in the second sector
+    unsigned long record = (SD_SECTOR_SIZE - SDIMAGE_HEADER_SIZE) / 3 + 5;
+    image[SDIMAGE_HEADER_SIZE + 3 * record] = 0;
+    testStart();
+    
+    unsigned char bpp = glcdGetCOLMOD();
+    unsigned char success = glcdDrawSDImage(
+        IMAGE_X, IMAGE_Y, IMAGE_SECTOR, buf, 1
+    );
+    sdEmuClose(&sd);
+    TEST_CHECK(!success, "run of 0 pixels accepted");
+    TEST_CHECK(sd.sectorsRead == 2, "%lu sectors read after a bad run",
+               sd.sectorsRead);
+    TEST_CHECK((glcdGetCOLMOD() == bpp) && (emu.bpp == bpp),
+               "pixel format not put back after a bad run");
+}
+
+/**
+ * @brief Checks that an image that doesn't fit where it's drawn, and
+ *        reading too many sectors at a time, are turned down without
+ *        drawing anything
+ */
+static void testRejected(void){
+    testEncode(SDIMAGE_RAW16);
+    testStart();
+    unsigned char success = glcdDrawSDImage(
+        GLCD_SIZE_HORZ - IMAGE_WIDTH + 1, 0, IMAGE_SECTOR, buf, 1
+    );
+    TEST_CHECK(!success, "image that doesn't fit drawn");
+    TEST_CHECK(sd.sectorsRead == 1, "%lu sectors read for an image that "
+               "doesn't fit", sd.sectorsRead);
+    TEST_CHECK(emu.stats.pixels == 0, "%lu pixels drawn for an image that "
+               "doesn't fit", emu.stats.pixels);
+    
+    // Checked before the buffer is used, so buf doesn't need to be as big
+    sd.selects = 0;
+    success = glcdDrawSDImage(
+        IMAGE_X, IMAGE_Y, IMAGE_SECTOR, buf, SDIMAGE_MAX_SECTORS + 1
+    );
+    sdEmuClose(&sd);
+    TEST_CHECK(!success && (sd.selects == 0),
+               "more than SDIMAGE_MAX_SECTORS sectors read at a time");
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    int fd = mkstemp(path);
+    if(fd < 0){
+        perror(path);
+        return 1;
+    }
+    close(fd);
+    
+    testMakeSource();
+    unsigned char numChunkSizes = sizeof(CHUNK_SECTORS);
+    for(unsigned char i = 0; i < sizeof(FORMATS) / sizeof(FORMATS[0]); i++){
+        for(unsigned char j = 0; j < numChunkSizes; j++){
+            testDraw(FORMATS[i], CHUNK_SECTORS[j]);
+            if(FORMATS[i] == SDIMAGE_RLE16){
+                testRecordSplit(CHUNK_SECTORS[j]);
+            }
+        }
+    }
+    testZeroRun();
+    testRejected();
+    
+    remove(path);
+    return TEST_RESULT("sdimage");
+}
@@ -0,0 +1,53 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Test
+ * @brief Checks shared by the host tests
+ * @details Each test in host/test is a program that runs the driver against
+ *          the emulated controller, and exits with a non-zero status if any
+ *          check failed. make -C host test builds and runs all of them
+ * @{
+ */
+
+#ifndef GLCD_TEST_H
+#define GLCD_TEST_H
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+
+/***************************** Private Variables *****************************/
+static unsigned testChecks = 0; /**< Checks made */
+static unsigned testFailures = 0; /**< Checks that failed */
+
+/********************************** Macros ***********************************/
+/**
+ * @brief Checks that a condition holds, printing the message (printf-style)
+ *        and where the check is if it doesn't
+ */
+#define TEST_CHECK(cond, ...)                                         \
+    do{                                                               \
+        testChecks++;                                                 \
+        if(!(cond)){                                                  \
+            testFailures++;                                           \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);           \
+            fprintf(stderr, __VA_ARGS__);                             \
+            fputc('\n', stderr);                                      \
+        }                                                             \
+    }while(0)
+
+/**
+ * @brief Prints the outcome of a test, and evaluates to its exit status
+ * @param name Name of the test
+ */
+#define TEST_RESULT(name)                                             \
+    (printf("%-12s %s (%u checks, %u failed)\n", (name),              \
+            (testFailures == 0) ? "ok" : "FAILED", testChecks,        \
+            testFailures), (testFailures == 0) ? 0 : 1)
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_TEST_H */
@@ -0,0 +1,148 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that a trace recorded by the driver is analyzed correctly
+ * @details Built with GLCD_TRACE. The driver sends a sequence with known
+ *          waste in it: a rectangle drawn twice over (unchanged CASET and
+ *          RASET, a repeated window setup, and overwritten pixels), and
+ *          INVOFF and MADCTL sent again after the shadow is forgotten. The
+ *          dump from glcdTraceDump is run through the analyzer, whose counts
+ *          must match, and whose byte count must match what the emulated
+ *          controller received
+ */
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_PIC.h"
+#include "../../src/GLCD/GLCD_Trace.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+#define OUTPUT_SIZE 2048
+
+static const unsigned char RECT_XS = 10, RECT_XE = 30;
+static const unsigned char RECT_YS = 10, RECT_YE = 30;
+static const unsigned long RECT_PIXELS = 20 * 20;
+static const unsigned long NEXT_PIXELS = 20 * 10; /**< In the second frame */
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static char path[] = "/tmp/glcd_trace_XXXXXX";
+static char output[OUTPUT_SIZE];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Sends the known sequence, recording it
+ */
+static void testRecord(void){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdTraceClear();
+    emuResetStats(&emu);
+    
+    // The same window twice, filled each time
+    glcdDrawRectangle(RECT_XS, RECT_XE, RECT_YS, RECT_YE, 0xFF0000);
+    glcdDrawRectangle(RECT_XS, RECT_XE, RECT_YS, RECT_YE, 0x0000FF);
+    
+    // Settings are only compared once the trace has seen them
+    glcd_invon();
+    glcd_invoff();
+    glcdSetOrigin(ORIGIN_BOTTOM_RIGHT);
+    glcdInvalidateShadow();
+    glcd_invoff();
+    glcdSetOrigin(ORIGIN_BOTTOM_RIGHT);
+    
+    glcdTraceMarkFrame();
+    TEST_CHECK(!PIE1bits.SSPIE, "marking a frame enabled the MSSP interrupt");
+    glcdDrawRectangle(40, 60, 40, 50, 0x00FF00);
+}
+
+/**
+ * @brief Dumps the trace to a file, in place of the EUSART
+ * @return 0 on success
+ */
+static int testDump(void){
+    int fd = mkstemp(path);
+    if(fd < 0){
+        perror(path);
+        return -1;
+    }
+    fflush(stdout);
+    int console = dup(STDOUT_FILENO);
+    dup2(fd, STDOUT_FILENO);
+    glcdTraceDump();
+    fflush(stdout);
+    dup2(console, STDOUT_FILENO);
+    close(console);
+    close(fd);
+    return 0;
+}
+
+/**
+ * @brief Runs the analyzer on the dump, keeping what it prints
+ * @return 0 on success
+ */
+static int testAnalyze(void){
+    char command[256];
+    snprintf(command, sizeof(command), "%s %s", TRACE_ANALYZER, path);
+    FILE* p = popen(command, "r");
+    if(p == NULL){
+        perror(command);
+        return -1;
+    }
+    size_t len = fread(output, 1, sizeof(output) - 1, p);
+    output[len] = '\0';
+    return (pclose(p) == 0) ? 0 : -1;
+}
+
+/**
+ * @brief Finds a count in the analyzer's summary
+ * @param name What the line starts with
+ * @return The first number after it, or -1 if there's no such line
+ */
+static long testCount(const char* name){
+    const char* line = strstr(output, name);
+    if(line == NULL){
+        return -1;
+    }
+    return strtol(line + strlen(name), NULL, 10);
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    testRecord();
+    TEST_CHECK(testDump() == 0, "couldn't dump the trace");
+    TEST_CHECK(testAnalyze() == 0, "analyzer failed:\n%s", output);
+    remove(path);
+    
+    long bytes = testCount("bytes ");
+    long frames = testCount("frames ");
+    long pixels = testCount("pixels ");
+    const char* overwritten = strstr(output, "pixels ");
+    long overdrawn = (overwritten != NULL) ?
+                     strtol(strchr(overwritten, '(') + 1, NULL, 10) : -1;
+    long unchanged = testCount("unchanged CASET/RASET");
+    long repeated = testCount("repeated window setups");
+    long redundant = testCount("redundant mode commands");
+    
+    TEST_CHECK(bytes == (long)emu.stats.bytes, "%ld bytes analyzed, %lu "
+               "sent", bytes, emu.stats.bytes);
+    TEST_CHECK(frames == 2, "%ld frames", frames);
+    TEST_CHECK(pixels == (long)(2 * RECT_PIXELS + NEXT_PIXELS),
+               "%ld pixels", pixels);
+    TEST_CHECK(overdrawn == (long)RECT_PIXELS, "%ld pixels overwritten",
+               overdrawn);
+    TEST_CHECK(unchanged == 2, "%ld unchanged CASET/RASET", unchanged);
+    TEST_CHECK(repeated == 1, "%ld repeated window setups", repeated);
+    TEST_CHECK(redundant == 2, "%ld redundant mode commands", redundant);
+    
+    return TEST_RESULT("trace");
+}
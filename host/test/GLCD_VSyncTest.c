@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that glcdDrawRectangleVSync never writes a panel row before
+ *        the scan has passed it
+ * @details The emulator backend drives TE from its model of the controller's
+ *          scan (see ST7735R_EmuBackend.h), and the same model tells when each
+ *          display RAM row is scanned. A row tears if the scan passes it
+ *          between its first and last pixel being stored, since that frame
+ *          shows part of the old row and part of the new one
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_PIC.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+static const unsigned char NARROW_WIDTH = 32; /**< Row width, in pixels */
+
+static const unsigned char BPPS[] = {12, 16, 18};
+static const glcd_origin_positions_e ORIGINS[] = {
+    ORIGIN_TOP_LEFT, ORIGIN_TOP_RIGHT, ORIGIN_BOTTOM_LEFT, ORIGIN_BOTTOM_RIGHT
+};
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static unsigned long pixels; /**< Pixels stored since the last reset */
+/** Per panel row, 1 + the times the scan had passed it when its first pixel
+    was stored (0 until one is) */
+static unsigned long long firstScan[EMU_PANEL_SIZE];
+static unsigned long long lastScan[EMU_PANEL_SIZE]; /**< Same, for the last */
+
+/***************************** Private Functions *****************************/
+static void testPixel(void* ctx, unsigned short memRow, unsigned short memCol){
+    (void)ctx;
+    (void)memCol;
+    unsigned short row = memRow - emu.rowOrigin;
+    if(row >= EMU_PANEL_SIZE){
+        return;
+    }
+    
+    // Display RAM row m is scanned on lines m, m + frame lines, ...
+    unsigned long long lines = emuGetScanLines();
+    unsigned long long scans = (lines < memRow) ? 0 :
+                               (lines - memRow) / emuGetFrameLines(&emu) + 1;
+    pixels++;
+    if(firstScan[row] == 0){
+        firstScan[row] = scans + 1;
+    }
+    lastScan[row] = scans + 1;
+}
+
+/**
+ * @brief Draws the whole screen in one color, and checks whether the scan
+ *        passed any row while it was being written
+ * @param vsync 1 to use glcdDrawRectangleVSync, 0 for glcdDrawRectangle
+ * @param color Color to draw
+ * @return Rows that tore
+ */
+static unsigned char testFill(unsigned char vsync, unsigned long color){
+    pixels = 0;
+    memset(firstScan, 0, sizeof(firstScan));
+    memset(lastScan, 0, sizeof(lastScan));
+    if(vsync){
+        glcdDrawRectangleVSync(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, color);
+    }
+    else{
+        glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, color);
+    }
+    TEST_CHECK(pixels == (unsigned long)GLCD_SIZE_HORZ * GLCD_SIZE_VERT,
+               "%lu pixels written", pixels);
+    
+    unsigned char torn = 0;
+    for(unsigned char row = 0; row < EMU_PANEL_SIZE; row++){
+        if(firstScan[row] != lastScan[row]){
+            torn++;
+        }
+    }
+    return torn;
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    emuSetPixelHook(&emu, testPixel, 0);
+    
+    initGLCD();
+    glcdEnableVSync();
+    
+    // A plain fill runs into the scan, which shows the model catches tearing
+    TEST_CHECK(testFill(0, 0x000000) > 0, "plain fill didn't tear");
+    
+    for(unsigned char i = 0; i < sizeof(BPPS); i++){
+        glcdSetCOLMOD(BPPS[i]);
+        for(unsigned char j = 0; j < sizeof(ORIGINS) / sizeof(ORIGINS[0]); j++){
+            glcdSetOrigin(ORIGINS[j]);
+            unsigned long color = (j & 1) ? 0xF00000 : 0x0000F0;
+            unsigned char n = testFill(1, color);
+            TEST_CHECK(n == 0, "%u bpp, origin %u: %u rows tore", BPPS[i],
+                       ORIGINS[j], n);
+            
+            // 12 bpp keeps the top 4 bits of each component
+            unsigned long got = emuGetPanelPixel(&emu, 64, 64);
+            TEST_CHECK((got & 0xF0F0F0) == color, "%u bpp, origin %u: color "
+                       "%06lX", BPPS[i], ORIGINS[j], got);
+        }
+    }
+    
+    // Fewer bytes per pixel fit more rows in a frame. Full-width rows are
+    // too long for more than one or two to fit at any format
+    glcdSetCOLMOD(18);
+    unsigned char rows18 = glcdGetVSyncRowsPerFrame(NARROW_WIDTH);
+    glcdSetCOLMOD(16);
+    unsigned char rows16 = glcdGetVSyncRowsPerFrame(NARROW_WIDTH);
+    glcdSetCOLMOD(12);
+    unsigned char rows12 = glcdGetVSyncRowsPerFrame(NARROW_WIDTH);
+    TEST_CHECK((rows12 > rows16) && (rows16 > rows18),
+               "rows per frame: %u at 12 bpp, %u at 16, %u at 18",
+               rows12, rows16, rows18);
+    
+    return TEST_RESULT("vsync");
+}
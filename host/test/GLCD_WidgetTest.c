@@ -0,0 +1,120 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Test
+ * @brief Checks that widgets updated a little at a time look the same as
+ *        widgets drawn from scratch
+ * @details Bars and readouts are taken through a sequence of values. After
+ *          each update, display RAM is saved, the screen is cleared, and the
+ *          widgets are invalidated and drawn again in full with the same
+ *          values. The two versions of display RAM must be the same. This is
+ *          done at 12, 16 and 18 bpp and at each origin, since odd pixel
+ *          counts at 12 bpp and the window order can both go wrong
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Test.h"
+#include "../../src/GLCD/GLCD_Widget.h"
+#include "../emulator/ST7735R_EmuBackend.h"
+
+/******************************** Constants **********************************/
+static const unsigned char BPPS[] = {12, 16, 18};
+static const glcd_origin_positions_e ORIGINS[] = {
+    ORIGIN_TOP_LEFT, ORIGIN_TOP_RIGHT, ORIGIN_BOTTOM_LEFT, ORIGIN_BOTTOM_RIGHT
+};
+
+static const unsigned short BAR_MAX = 100;
+static const unsigned short BAR_VALUES[] = {
+    0, 50, 20, 100, 99, 1, 0, 73, 73, 37, 100
+};
+
+static const char* const READOUT_TEXTS[] = {
+    "12.5", "12.6", "1000", "", "abcdefghijkl", "ab", "  ab", "ab"
+};
+static const long READOUT_NUMBERS[] = {
+    0, 7, -7, 123, 124, 99999, 123456, -42
+};
+
+/***************************** Private Variables *****************************/
+static st7735r_emu_t emu;
+static unsigned char incremental[EMU_MEM_ROWS][EMU_MEM_COLS][3];
+
+static glcd_bar_t progress; /**< Along x, with a border */
+static glcd_bar_t gauge; /**< Along y, without */
+static glcd_readout_t label; /**< Text */
+static glcd_readout_t counter; /**< Numbers */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Clears the screen, and makes every widget draw itself in full on
+ *        its next update
+ */
+static void testClear(void){
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, 0x000000);
+    glcdWidgetInvalidate(progress.drawn);
+    glcdWidgetInvalidate(gauge.drawn);
+    glcdWidgetInvalidate(label.drawn);
+    glcdWidgetInvalidate(counter.drawn);
+}
+
+/**
+ * @brief Updates the widgets
+ * @param i Index of the values to show
+ */
+static void testUpdate(unsigned char i){
+    unsigned char numBars = sizeof(BAR_VALUES) / sizeof(BAR_VALUES[0]);
+    unsigned char numTexts = sizeof(READOUT_TEXTS) / sizeof(READOUT_TEXTS[0]);
+    unsigned char numNumbers =
+        sizeof(READOUT_NUMBERS) / sizeof(READOUT_NUMBERS[0]);
+    glcdBarSet(&progress, BAR_VALUES[i % numBars], BAR_MAX);
+    glcdBarSet(&gauge, BAR_VALUES[(i + 3) % numBars], BAR_MAX);
+    glcdReadoutSetText(&label, READOUT_TEXTS[i % numTexts]);
+    glcdReadoutSetNumber(&counter, READOUT_NUMBERS[i % numNumbers]);
+}
+
+/**
+ * @brief Takes the widgets through their values, comparing each incremental
+ *        update with a full redraw
+ * @param bpp Interface pixel format
+ * @param origin Origin to draw from
+ */
+static void testWidgets(unsigned char bpp, glcd_origin_positions_e origin){
+    emuInit(&emu, EMU_PANEL_V1_1);
+    emuAttach(&emu);
+    initGLCD();
+    glcdSetCOLMOD(bpp);
+    glcdSetOrigin(origin);
+    
+    glcdBarInit(&progress, 5, 105, 10, 21, AXIS_X, 1, 0x00FF00, 0x202020);
+    glcdBarInit(&gauge, 110, 123, 10, 117, AXIS_Y, 0, 0xFF8000, 0x000040);
+    glcdReadoutInit(&label, 3, 40, 7, 0xFFFFFF, 0x0000FF);
+    glcdReadoutInit(&counter, 9, 60, 5, 0xFFFF00, 0x000000);
+    testClear();
+    
+    // Twice through the bar values, so each bar sees every change
+    unsigned char numSteps = 2 * sizeof(BAR_VALUES) / sizeof(BAR_VALUES[0]);
+    for(unsigned char i = 0; i < numSteps; i++){
+        testUpdate(i);
+        memcpy(incremental, emu.mem, sizeof(incremental));
+        
+        testClear();
+        testUpdate(i);
+        TEST_CHECK(memcmp(incremental, emu.mem, sizeof(incremental)) == 0,
+                   "%u bpp, origin %u, step %u: incremental update differs "
+                   "from a full redraw", bpp, origin, i);
+    }
+}
+
+/***************************** Public Functions ******************************/
+int main(void){
+    for(unsigned char i = 0; i < sizeof(BPPS); i++){
+        for(unsigned char j = 0; j < sizeof(ORIGINS) / sizeof(ORIGINS[0]); j++){
+            testWidgets(BPPS[i], ORIGINS[j]);
+        }
+    }
+    
+    return TEST_RESULT("widget");
+}
@@ -0,0 +1,670 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup ST7735R_Trace
+ * @brief Replays a recorded SPI stream through the emulated controller and
+ *        points out bus traffic that had no effect
+ * @details Reads either of:
+ *           - A dump from glcdTraceDump (see GLCD_Trace.h), as captured from
+ *             the EUSART. Anything before the TRACE line is skipped, and only
+ *             the first dump is used. Parameter bytes beyond the first
+ *             TRACE_PARAMS of each command and all pixel data are replayed
+ *             as zeros, which doesn't change where the pixels go
+ *           - A CSV export from a logic analyzer's SPI decoder, one row per
+ *             byte, with a header row naming the columns: time (seconds), cs
+ *             (optional, 0 selects), dc, rs or a0 (0 for commands), mosi,
+ *             data or value (the byte, decimal or 0x-prefixed hex) and te
+ *             (optional). Other columns are ignored, and so are rows with cs
+ *             high, which are for other devices on the bus (e.g. an SD card)
+ *
+ *          Frames are delimited by the trace's frame markers, by rising
+ *          edges of te, or by a fixed period given with -f. Reported:
+ *           - CASET/RASET that set the addresses they already had
+ *           - Repeated window setups: CASET/RASET/RAMWR for the window that
+ *             was already being written, when the pixels written since the
+ *             last RAMWR filled it a whole number of times, so the address
+ *             counters were already back at its start
+ *           - MADCTL, COLMOD and mode commands (INVON/INVOFF, IDMON/IDMOFF,
+ *             DISPON/DISPOFF, SLPIN/SLPOUT, PTLON/NORON) that didn't change
+ *             anything
+ *           - Pixels written more than once within a frame
+ *
+ *          Settings are only compared once they've been seen in the stream,
+ *          since a trace may start after they were sent.
+ *
+ *          Usage: st7735r_trace [-v] [-f period_us] [-p v1|v2] [file]
+ *          reading stdin if no file is given. -v lists every finding
+ * @{
+ */
+
+/********************************* Includes **********************************/
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "../emulator/ST7735R_Emu.h"
+
+/********************************** Macros ***********************************/
+#define TRACE_LINE_SIZE 512 /**< Longest input line */
+#define TRACE_MAX_COLUMNS 16 /**< Most CSV columns looked at */
+#define TRACE_KEPT_PARAMS 4 /**< Parameter bytes compared */
+
+/******************************** Constants **********************************/
+enum{
+    CMD_SWRESET = 0x01,
+    CMD_SLPIN = 0x10,
+    CMD_SLPOUT = 0x11,
+    CMD_PTLON = 0x12,
+    CMD_NORON = 0x13,
+    CMD_INVOFF = 0x20,
+    CMD_INVON = 0x21,
+    CMD_DISPOFF = 0x28,
+    CMD_DISPON = 0x29,
+    CMD_CASET = 0x2A,
+    CMD_RASET = 0x2B,
+    CMD_RAMWR = 0x2C,
+    CMD_MADCTL = 0x36,
+    CMD_IDMOFF = 0x38,
+    CMD_IDMON = 0x39,
+    CMD_COLMOD = 0x3A
+};
+
+/** @brief Commands that switch between two modes */
+typedef enum{
+    MODE_SLEEP,   /**< SLPIN/SLPOUT */
+    MODE_PARTIAL, /**< PTLON/NORON */
+    MODE_INVERT,  /**< INVON/INVOFF */
+    MODE_DISPLAY, /**< DISPON/DISPOFF */
+    MODE_IDLE,    /**< IDMON/IDMOFF */
+    NUM_MODES
+}trace_mode_e;
+
+static const long UNKNOWN = -1;
+
+/********************************** Types ************************************/
+/** @brief Findings of one kind */
+typedef struct{
+    unsigned long count;
+    unsigned long bytes; /**< Bus bytes they took */
+}trace_finding_t;
+
+/** @brief State of the analysis */
+typedef struct{
+    st7735r_emu_t emu;
+    
+    // Command being received
+    unsigned char cmd;
+    unsigned char params[TRACE_KEPT_PARAMS];
+    unsigned long numParams;
+    unsigned char inCommand;
+    
+    // Settings last seen, or UNKNOWN
+    long caset;
+    long raset;
+    long madctl;
+    long colmod;
+    long modes[NUM_MODES];
+    
+    // Window of the last RAMWR, and the pixels written since
+    unsigned char windowValid;
+    long windowCaset;
+    long windowRaset;
+    unsigned long windowStartPixels;
+    
+    // Window setup bytes since the last pixel data, and how many of them
+    // are already counted as unchanged CASET/RASET
+    unsigned long setupBytes;
+    unsigned long setupCounted;
+    
+    // Frame each display RAM location was last written in
+    unsigned long written[EMU_MEM_ROWS][EMU_MEM_COLS];
+    unsigned long frame;
+    
+    // Totals
+    unsigned long bytes;
+    unsigned long commandBytes;
+    unsigned long pixels;
+    unsigned long overdrawn;
+    trace_finding_t unchangedAddress;
+    trace_finding_t repeatedWindow;
+    trace_finding_t redundantMode;
+    
+    unsigned char verbose;
+}trace_t;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Prints a finding when listing them
+ * @param t The analysis
+ * @param what Description
+ */
+static void traceReport(const trace_t* t, const char* what){
+    if(!t->verbose){
+        return;
+    }
+    printf("frame %lu, byte %lu: %s", t->frame, t->bytes, what);
+    for(unsigned long i = 0; (i < t->numParams) && (i < TRACE_KEPT_PARAMS); i++){
+        printf(" %02X", t->params[i]);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Counts pixels written to the same location twice in a frame. Called
+ *        by the emulator
+ */
+static void tracePixel(void* ctx, unsigned short memRow, unsigned short memCol){
+    trace_t* t = ctx;
+    t->pixels++;
+    if(t->written[memRow][memCol] == t->frame){
+        t->overdrawn++;
+    }
+    t->written[memRow][memCol] = t->frame;
+}
+
+/**
+ * @brief Packs the 4 parameters of CASET or RASET
+ * @return The addresses, or UNKNOWN if the parameters weren't all sent
+ */
+static long tracePackAddress(const trace_t* t){
+    if(t->numParams < 4){
+        return UNKNOWN;
+    }
+    return ((long)t->params[0] << 24) | ((long)t->params[1] << 16) |
+           ((long)t->params[2] << 8) | t->params[3];
+}
+
+/**
+ * @brief Number of addresses in a packed CASET or RASET
+ * @return Addresses from start to end, or 0 if end is before start
+ */
+static unsigned long traceAddressSpan(long packed){
+    long start = (packed >> 16) & 0xFFFF;
+    long end = packed & 0xFFFF;
+    return (end >= start) ? (unsigned long)(end - start + 1) : 0;
+}
+
+/**
+ * @brief Checks a command that switches between two modes
+ * @param t The analysis
+ * @param mode Which setting it changes
+ * @param name Command name, for the listing
+ */
+static void traceMode(trace_t* t, trace_mode_e mode, const char* name){
+    if(t->modes[mode] == t->cmd){
+        t->redundantMode.count++;
+        t->redundantMode.bytes += 1 + t->numParams;
+        traceReport(t, name);
+    }
+    t->modes[mode] = t->cmd;
+}
+
+/**
+ * @brief Checks a command that sets a single-byte register
+ * @param t The analysis
+ * @param reg Last value seen
+ * @param name Command name, for the listing
+ * @return 1 if the value changed
+ */
+static unsigned char traceRegister(trace_t* t, long* reg, const char* name){
+    if(t->numParams == 0){
+        return 0;
+    }
+    if(*reg == t->params[0]){
+        t->redundantMode.count++;
+        t->redundantMode.bytes += 1 + t->numParams;
+        traceReport(t, name);
+        return 0;
+    }
+    *reg = t->params[0];
+    return 1;
+}
+
+/**
+ * @brief Checks CASET or RASET
+ * @param t The analysis
+ * @param reg Last value seen
+ * @param name Command name, for the listing
+ */
+static void traceAddress(trace_t* t, long* reg, const char* name){
+    long value = tracePackAddress(t);
+    t->setupBytes += 1 + t->numParams;
+    if((value != UNKNOWN) && (value == *reg)){
+        t->unchangedAddress.count++;
+        t->unchangedAddress.bytes += 1 + t->numParams;
+        t->setupCounted += 1 + t->numParams;
+        traceReport(t, name);
+    }
+    *reg = value;
+}
+
+/**
+ * @brief Checks RAMWR, when it's received
+ * @param t The analysis
+ */
+static void traceRamwr(trace_t* t){
+    t->setupBytes++;
+    
+    unsigned long area = traceAddressSpan(t->caset) *
+                         traceAddressSpan(t->raset);
+    unsigned long written = t->emu.stats.pixels - t->windowStartPixels;
+    if((t->caset != UNKNOWN) && (t->raset != UNKNOWN) && t->windowValid &&
+       (t->caset == t->windowCaset) && (t->raset == t->windowRaset) &&
+       (area > 0) && (written % area == 0)){
+        t->repeatedWindow.count++;
+        t->repeatedWindow.bytes += t->setupBytes - t->setupCounted;
+        t->setupCounted = t->setupBytes;
+        traceReport(t, "repeated window setup");
+    }
+    t->windowValid = 1;
+    t->windowCaset = t->caset;
+    t->windowRaset = t->raset;
+    t->windowStartPixels = t->emu.stats.pixels;
+}
+
+/**
+ * @brief Checks the command just completed
+ * @param t The analysis
+ */
+static void traceEndCommand(trace_t* t){
+    if(!t->inCommand){
+        return;
+    }
+    t->inCommand = 0;
+    switch(t->cmd){
+        case CMD_SWRESET:
+            // Everything goes back to its default, which isn't tracked
+            t->caset = UNKNOWN;
+            t->raset = UNKNOWN;
+            t->madctl = UNKNOWN;
+            t->colmod = UNKNOWN;
+            for(unsigned char i = 0; i < NUM_MODES; i++){
+                t->modes[i] = UNKNOWN;
+            }
+            t->windowValid = 0;
+            break;
+        case CMD_CASET:
+            traceAddress(t, &t->caset, "unchanged CASET");
+            break;
+        case CMD_RASET:
+            traceAddress(t, &t->raset, "unchanged RASET");
+            break;
+        case CMD_MADCTL:
+            if(traceRegister(t, &t->madctl, "redundant MADCTL")){
+                // The same addresses now mean a different area
+                t->windowValid = 0;
+            }
+            break;
+        case CMD_COLMOD:
+            traceRegister(t, &t->colmod, "redundant COLMOD");
+            break;
+        case CMD_SLPIN:
+            traceMode(t, MODE_SLEEP, "redundant SLPIN");
+            break;
+        case CMD_SLPOUT:
+            traceMode(t, MODE_SLEEP, "redundant SLPOUT");
+            break;
+        case CMD_PTLON:
+            traceMode(t, MODE_PARTIAL, "redundant PTLON");
+            break;
+        case CMD_NORON:
+            traceMode(t, MODE_PARTIAL, "redundant NORON");
+            break;
+        case CMD_INVOFF:
+            traceMode(t, MODE_INVERT, "redundant INVOFF");
+            break;
+        case CMD_INVON:
+            traceMode(t, MODE_INVERT, "redundant INVON");
+            break;
+        case CMD_DISPOFF:
+            traceMode(t, MODE_DISPLAY, "redundant DISPOFF");
+            break;
+        case CMD_DISPON:
+            traceMode(t, MODE_DISPLAY, "redundant DISPON");
+            break;
+        case CMD_IDMOFF:
+            traceMode(t, MODE_IDLE, "redundant IDMOFF");
+            break;
+        case CMD_IDMON:
+            traceMode(t, MODE_IDLE, "redundant IDMON");
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Feeds a byte to the analysis and the emulator
+ * @param t The analysis
+ * @param byte The byte
+ * @param isCmd 1 if it was sent as a command
+ */
+static void traceByte(trace_t* t, unsigned char byte, unsigned char isCmd){
+    t->bytes++;
+    emuSetRS(&t->emu, isCmd ? 0 : 1);
+    if(isCmd){
+        traceEndCommand(t);
+        t->commandBytes++;
+        t->cmd = byte;
+        t->numParams = 0;
+        t->inCommand = 1;
+        if(byte == CMD_RAMWR){
+            traceRamwr(t);
+        }
+    }
+    else{
+        if(t->numParams < TRACE_KEPT_PARAMS){
+            t->params[t->numParams] = byte;
+        }
+        t->numParams++;
+        if(t->inCommand && (t->cmd == CMD_RAMWR)){
+            t->setupBytes = 0;
+            t->setupCounted = 0;
+        }
+    }
+    emuWrite(&t->emu, byte);
+}
+
+/**
+ * @brief Starts a new frame
+ * @param t The analysis
+ */
+static void traceFrame(trace_t* t){
+    t->frame++;
+}
+
+/**
+ * @brief Reads a dump from glcdTraceDump
+ * @param t The analysis
+ * @param f Input, after the TRACE line
+ * @param header The TRACE line
+ */
+static void traceReadDump(trace_t* t, FILE* f, const char* header){
+    unsigned long records = 0, dropped = 0;
+    sscanf(header, "TRACE %lu %lu", &records, &dropped);
+    if(dropped > 0){
+        fprintf(stderr, "note: %lu older records were overwritten, so the "
+                "trace starts part way through\n", dropped);
+    }
+    
+    emuSetCS(&t->emu, 0);
+    char line[TRACE_LINE_SIZE];
+    while(fgets(line, sizeof(line), f) != NULL){
+        char* p = line;
+        if(strncmp(p, "END", 3) == 0){
+            break;
+        }
+        else if(*p == 'F'){
+            traceEndCommand(t);
+            traceFrame(t);
+        }
+        else if(*p == 'C'){
+            unsigned long cmd = strtoul(p + 1, &p, 16);
+            unsigned long count = strtoul(p, &p, 10);
+            traceByte(t, cmd, 1);
+            for(unsigned long i = 0; i < count; i++){
+                // Parameters kept in the record, then zeros
+                char* end;
+                unsigned long param = strtoul(p, &end, 16);
+                if(end == p){
+                    param = 0;
+                }
+                p = end;
+                traceByte(t, param, 0);
+            }
+        }
+        else if(*p == 'D'){
+            unsigned long count = strtoul(p + 1, NULL, 10);
+            for(unsigned long i = 0; i < count; i++){
+                traceByte(t, 0, 0);
+            }
+        }
+    }
+    emuSetCS(&t->emu, 1);
+}
+
+/**
+ * @brief Splits a CSV line into fields in place, removing quotes and spaces
+ * @param line The line
+ * @param fields Where to put the fields
+ * @return Number of fields
+ */
+static int traceSplit(char* line, char* fields[TRACE_MAX_COLUMNS]){
+    int n = 0;
+    char* p = line;
+    while(n < TRACE_MAX_COLUMNS){
+        while(isspace((unsigned char)*p) || (*p == '"')){
+            p++;
+        }
+        fields[n++] = p;
+        char* end = strchr(p, ',');
+        char* next = (end != NULL) ? end + 1 : NULL;
+        if(end == NULL){
+            end = p + strlen(p);
+        }
+        while((end > p) && (isspace((unsigned char)end[-1]) || (end[-1] == '"'))){
+            end--;
+        }
+        *end = '\0';
+        if(next == NULL){
+            break;
+        }
+        p = next;
+    }
+    return n;
+}
+
+/**
+ * @brief Finds a CSV column by the start of its name, ignoring case
+ * @param fields Header fields
+ * @param n Number of fields
+ * @param names Names to look for, ending with 0
+ * @return Column index, or -1 if there's none
+ */
+static int traceFindColumn(char* fields[], int n, const char* const names[]){
+    for(int i = 0; i < n; i++){
+        for(const char* const* name = names; *name != 0; name++){
+            size_t len = strlen(*name);
+            if((strncasecmp(fields[i], *name, len) == 0) &&
+               !isalpha((unsigned char)fields[i][len])){
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Reads a logic analyzer CSV export
+ * @param t The analysis
+ * @param f Input, after the header row
+ * @param header The header row
+ * @param periodUs Frame period for -f, or 0 to use te
+ * @return 0 on success, -1 if a required column is missing
+ */
+static int traceReadCSV(trace_t* t, FILE* f, char* header, double periodUs){
+    static const char* const TIME[] = {"time", 0};
+    static const char* const CS[] = {"cs", "ncs", 0};
+    static const char* const DC[] = {"dc", "d/c", "rs", "a0", 0};
+    static const char* const DATA[] = {"mosi", "data", "value", 0};
+    static const char* const TE[] = {"te", 0};
+    
+    char* fields[TRACE_MAX_COLUMNS];
+    int n = traceSplit(header, fields);
+    int time = traceFindColumn(fields, n, TIME);
+    int cs = traceFindColumn(fields, n, CS);
+    int dc = traceFindColumn(fields, n, DC);
+    int data = traceFindColumn(fields, n, DATA);
+    int te = traceFindColumn(fields, n, TE);
+    if((dc < 0) || (data < 0) || ((periodUs > 0) && (time < 0))){
+        fprintf(stderr, "error: the CSV needs dc (or rs, a0) and mosi (or "
+                "data, value) columns, and time for -f\n");
+        return -1;
+    }
+    
+    unsigned char lastTE = 1;
+    unsigned long lastPeriod = 0;
+    double start = 0;
+    unsigned char started = 0;
+    char line[TRACE_LINE_SIZE];
+    while(fgets(line, sizeof(line), f) != NULL){
+        n = traceSplit(line, fields);
+        if((n <= dc) || (n <= data) || (fields[data][0] == '\0')){
+            continue;
+        }
+        
+        // Frame boundaries
+        if(periodUs > 0){
+            double now = atof(fields[time]) * 1e6;
+            if(!started){
+                start = now;
+                started = 1;
+            }
+            unsigned long period = (now - start) / periodUs;
+            if(period != lastPeriod){
+                traceEndCommand(t);
+                traceFrame(t);
+                lastPeriod = period;
+            }
+        }
+        else if((te >= 0) && (n > te)){
+            unsigned char level = strtoul(fields[te], NULL, 0) != 0;
+            if(level && !lastTE){
+                traceEndCommand(t);
+                traceFrame(t);
+            }
+            lastTE = level;
+        }
+        
+        // Bytes sent while the display is deselected are for other devices
+        // on the bus (e.g. an SD card), and don't reach the controller
+        unsigned char deselected = ((cs >= 0) && (n > cs)) ?
+                                   (strtoul(fields[cs], NULL, 0) != 0) : 0;
+        emuSetCS(&t->emu, deselected);
+        if(deselected){
+            continue;
+        }
+        traceByte(t, strtoul(fields[data], NULL, 0),
+                  strtoul(fields[dc], NULL, 0) == 0);
+    }
+    emuSetCS(&t->emu, 1);
+    return 0;
+}
+
+/**
+ * @brief Prints a count as a share of a total
+ */
+static void tracePrintShare(
+    const char* name,
+    unsigned long count,
+    unsigned long bytes,
+    unsigned long total
+)
+{
+    printf("%-24s %8lu  %8lu bytes  %5.1f%%\n", name, count, bytes,
+           (total > 0) ? 100.0 * bytes / total : 0.0);
+}
+
+/**
+ * @brief Prints the totals
+ * @param t The analysis
+ */
+static void tracePrintSummary(const trace_t* t){
+    unsigned long wasted = t->unchangedAddress.bytes +
+                           t->repeatedWindow.bytes + t->redundantMode.bytes;
+    printf("bytes                    %8lu  (%lu commands, %lu data)\n",
+           t->bytes, t->commandBytes, t->bytes - t->commandBytes);
+    printf("frames                   %8lu\n", t->frame);
+    printf("pixels                   %8lu  (%lu overwritten in the same frame, "
+           "%.1f%%)\n", t->pixels, t->overdrawn,
+           (t->pixels > 0) ? 100.0 * t->overdrawn / t->pixels : 0.0);
+    tracePrintShare("unchanged CASET/RASET", t->unchangedAddress.count,
+                    t->unchangedAddress.bytes, t->bytes);
+    tracePrintShare("repeated window setups", t->repeatedWindow.count,
+                    t->repeatedWindow.bytes, t->bytes);
+    tracePrintShare("redundant mode commands", t->redundantMode.count,
+                    t->redundantMode.bytes, t->bytes);
+    tracePrintShare("total wasted",
+                    t->unchangedAddress.count + t->repeatedWindow.count +
+                    t->redundantMode.count, wasted, t->bytes);
+}
+
+/***************************** Public Functions ******************************/
+int main(int argc, char* argv[]){
+    static trace_t t;
+    emu_panel_e panel = EMU_PANEL_V1_1;
+    double periodUs = 0;
+    const char* path = NULL;
+    for(int i = 1; i < argc; i++){
+        if(strcmp(argv[i], "-v") == 0){
+            t.verbose = 1;
+        }
+        else if((strcmp(argv[i], "-f") == 0) && (i + 1 < argc)){
+            periodUs = atof(argv[++i]);
+        }
+        else if((strcmp(argv[i], "-p") == 0) && (i + 1 < argc)){
+            panel = (strcmp(argv[++i], "v2") == 0) ? EMU_PANEL_V2_1 :
+                                                     EMU_PANEL_V1_1;
+        }
+        else if(argv[i][0] != '-'){
+            path = argv[i];
+        }
+        else{
+            fprintf(stderr, "usage: %s [-v] [-f period_us] [-p v1|v2] "
+                    "[file]\n", argv[0]);
+            return 2;
+        }
+    }
+    
+    FILE* f = (path != NULL) ? fopen(path, "r") : stdin;
+    if(f == NULL){
+        perror(path);
+        return 1;
+    }
+    
+    emuInit(&t.emu, panel);
+    emuSetPixelHook(&t.emu, tracePixel, &t);
+    t.frame = 1;
+    t.caset = UNKNOWN;
+    t.raset = UNKNOWN;
+    t.madctl = UNKNOWN;
+    t.colmod = UNKNOWN;
+    for(unsigned char i = 0; i < NUM_MODES; i++){
+        t.modes[i] = UNKNOWN;
+    }
+    
+    // A CSV starts with its header row. Otherwise, look for a dump
+    char line[TRACE_LINE_SIZE];
+    int result = -1;
+    while(fgets(line, sizeof(line), f) != NULL){
+        if(strchr(line, ',') != NULL){
+            result = traceReadCSV(&t, f, line, periodUs);
+            break;
+        }
+        else if(strncmp(line, "TRACE", 5) == 0){
+            traceReadDump(&t, f, line);
+            result = 0;
+            break;
+        }
+    }
+    traceEndCommand(&t);
+    if(f != stdin){
+        fclose(f);
+    }
+    if(result != 0){
+        if(t.bytes == 0){
+            fprintf(stderr, "error: no trace found\n");
+        }
+        return 1;
+    }
+    
+    tracePrintSummary(&t);
+    return 0;
+}
+
+/**
+ * @}
+ */
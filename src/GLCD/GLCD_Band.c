@@ -0,0 +1,241 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Band
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Band.h"
+
+/******************************** Constants **********************************/
+static const unsigned char BAND_PRIM_RECT = 0;
+static const unsigned char BAND_PRIM_TEXT = 1;
+
+/********************************** Types ************************************/
+/** @brief A recorded primitive */
+typedef struct{
+    unsigned char type;
+    unsigned char XS;
+    unsigned char XE;
+    unsigned char YS;
+    unsigned char YE;
+    unsigned char fg; /**< Palette index of a rect, or of text characters */
+    unsigned char bg; /**< Palette index of text cells */
+    const char* str;
+}band_prim_t;
+
+/***************************** Private Variables *****************************/
+// Pixels of the current band. Columns are stored in the order the window
+// is filled, two rows per byte (the even row in the lower nibble)
+static unsigned char band[BAND_WIDTH][BAND_ROWS / 2];
+
+static unsigned long palette[BAND_PALETTE_SIZE];
+static band_prim_t prims[BAND_MAX_PRIMITIVES];
+static unsigned char numPrims = 0;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Sets a pixel of the band buffer
+ * @param x Column
+ * @param r Row within the band
+ * @param index Palette index
+ */
+static void bandSetPixel(unsigned char x, unsigned char r, unsigned char index){
+    unsigned char* p = &band[x][r >> 1];
+    if(r & 1){
+        *p = (*p & 0x0F) | (index << 4);
+    }
+    else{
+        *p = (*p & 0xF0) | (index & 0x0F);
+    }
+}
+
+/**
+ * @brief Gets a pixel of the band buffer
+ * @param x Column
+ * @param r Row within the band
+ * @return Palette index
+ */
+static unsigned char bandGetPixel(unsigned char x, unsigned char r){
+    unsigned char p = band[x][r >> 1];
+    return (r & 1) ? (p >> 4) : (p & 0x0F);
+}
+
+/**
+ * @brief Draws the part of a rectangle inside the band
+ * @param prim The rectangle
+ * @param YS First row of the band
+ * @param rows Rows in the band
+ */
+static void bandDrawRect(
+    const band_prim_t* prim,
+    unsigned char YS,
+    unsigned char rows
+)
+{
+    unsigned char r0 = (prim->YS > YS) ? prim->YS - YS : 0;
+    unsigned char r1 = (prim->YE < YS + rows) ? prim->YE - YS : rows;
+    unsigned char XE = (prim->XE < BAND_WIDTH) ? prim->XE : BAND_WIDTH;
+    for(unsigned char x = prim->XS; x < XE; x++){
+        for(unsigned char r = r0; r < r1; r++){
+            bandSetPixel(x, r, prim->fg);
+        }
+    }
+}
+
+/**
+ * @brief Draws the part of a string inside the band
+ * @param prim The string
+ * @param YS First row of the band
+ * @param rows Rows in the band
+ */
+static void bandDrawText(
+    const band_prim_t* prim,
+    unsigned char YS,
+    unsigned char rows
+)
+{
+    unsigned char r0 = (prim->YS > YS) ? prim->YS - YS : 0;
+    unsigned char r1 = (prim->YE < YS + rows) ? prim->YE - YS : rows;
+    unsigned char x = prim->XS;
+    
+    for(const char* c = prim->str; *c != '\0'; c++){
+        const unsigned char* glyph = fontGetGlyph(*c);
+        for(unsigned char col = 0; col < FONT_CHAR_WIDTH; col++, x++){
+            if(x >= BAND_WIDTH){
+                return;
+            }
+            unsigned char bits = (col < FONT_GLYPH_WIDTH) ? glyph[col] : 0;
+            for(unsigned char r = r0; r < r1; r++){
+                // Row of the character cell this band row falls on
+                unsigned char cellRow = YS + r - prim->YS;
+                if((bits >> cellRow) & 1){
+                    bandSetPixel(x, r, prim->fg);
+                }
+                else if(prim->bg != BAND_TRANSPARENT){
+                    bandSetPixel(x, r, prim->bg);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sends the band buffer to the display. Runs of the same color are
+ *        written with one call each
+ * @param YS First row of the band
+ * @param rows Rows in the band
+ */
+static void bandSend(unsigned char YS, unsigned char rows){
+    if(!glcdSetWindow(0, BAND_WIDTH, YS, YS + rows)){
+        return;
+    }
+    
+    unsigned char runIndex = bandGetPixel(0, 0);
+    unsigned short runLength = 0;
+    for(unsigned char x = 0; x < BAND_WIDTH; x++){
+        for(unsigned char r = 0; r < rows; r++){
+            unsigned char index = bandGetPixel(x, r);
+            if(index != runIndex){
+                glcdWritePixels(palette[runIndex], runLength);
+                runIndex = index;
+                runLength = 0;
+            }
+            runLength++;
+        }
+    }
+    glcdWritePixels(palette[runIndex], runLength);
+    glcdEndPixels();
+}
+
+/***************************** Public Functions ******************************/
+void glcdBandSetPalette(unsigned char index, unsigned long color){
+    if(index < BAND_PALETTE_SIZE){
+        palette[index] = color;
+    }
+}
+
+void glcdBandClear(void){
+    numPrims = 0;
+}
+
+unsigned char glcdBandRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned char index
+)
+{
+    if(numPrims == BAND_MAX_PRIMITIVES){
+        return 0;
+    }
+    
+    band_prim_t* prim = &prims[numPrims++];
+    prim->type = BAND_PRIM_RECT;
+    prim->XS = XS;
+    prim->XE = XE;
+    prim->YS = YS;
+    prim->YE = YE;
+    prim->fg = index & 0x0F;
+    return 1;
+}
+
+unsigned char glcdBandText(
+    unsigned char x,
+    unsigned char y,
+    const char* str,
+    unsigned char fg,
+    unsigned char bg
+)
+{
+    if(numPrims == BAND_MAX_PRIMITIVES){
+        return 0;
+    }
+    
+    band_prim_t* prim = &prims[numPrims++];
+    prim->type = BAND_PRIM_TEXT;
+    prim->XS = x;
+    prim->XE = BAND_WIDTH; // Cut off at the edge while drawing
+    prim->YS = y;
+    prim->YE = y + FONT_CHAR_HEIGHT;
+    prim->fg = fg & 0x0F;
+    prim->bg = (bg == BAND_TRANSPARENT) ? BAND_TRANSPARENT : bg & 0x0F;
+    prim->str = str;
+    return 1;
+}
+
+void glcdBandRender(unsigned char YS, unsigned char YE){
+    for(unsigned char y = YS; y < YE; y += BAND_ROWS){
+        unsigned char rows = (YE - y < BAND_ROWS) ? YE - y : BAND_ROWS;
+        
+        // Start from palette entry 0
+        for(unsigned char x = 0; x < BAND_WIDTH; x++){
+            for(unsigned char i = 0; i < BAND_ROWS / 2; i++){
+                band[x][i] = 0;
+            }
+        }
+        
+        for(unsigned char i = 0; i < numPrims; i++){
+            const band_prim_t* prim = &prims[i];
+            if((prim->YE <= y) || (prim->YS >= y + rows) ||
+               (prim->XS >= prim->XE)){
+                continue;
+            }
+            if(prim->type == BAND_PRIM_TEXT){
+                bandDrawText(prim, y, rows);
+            }
+            else{
+                bandDrawRect(prim, y, rows);
+            }
+        }
+        
+        bandSend(y, rows);
+        
+        if(YE - y <= BAND_ROWS){
+            break; // Avoid wrapping past 255
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Band
+ * @brief Renders a list of primitives into a RAM strip, one band at a time
+ * @details There isn't enough RAM for a framebuffer, so the screen is built
+ *          up BAND_ROWS rows at a time instead. Primitives (rectangles, text)
+ *          are recorded into a list with colors given as palette indices.
+ *          glcdBandRender composites every primitive touching a band into a
+ *          4-bit-per-pixel buffer, in the order they were recorded, and then
+ *          streams the band out in a single window. Every pixel is sent
+ *          exactly once per frame and nothing is drawn over, so overlapping
+ *          primitives don't flicker.
+ *
+ *          The band buffer takes BAND_WIDTH * BAND_ROWS / 2 bytes of RAM
+ * @{
+ */
+
+#ifndef GLCD_BAND_H
+#define GLCD_BAND_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+#include "GLCD_Font.h"
+
+/********************************** Macros ***********************************/
+/** @brief Pixels along the x-axis covered by the band buffer */
+#define BAND_WIDTH 128
+
+/** @brief Pixels along the y-axis in each band (must be even) */
+#define BAND_ROWS 8
+
+/** @brief Primitives the list can hold */
+#define BAND_MAX_PRIMITIVES 32
+
+/** @brief Number of palette entries */
+#define BAND_PALETTE_SIZE 16
+
+/** @brief Background index meaning "leave what's underneath" for text */
+#define BAND_TRANSPARENT 0xFF
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets a palette entry. Entry 0 is the color of anything that no
+ *        primitive covers
+ * @param index Palette index (max: BAND_PALETTE_SIZE - 1)
+ * @param color 24-bit color
+ */
+void glcdBandSetPalette(unsigned char index, unsigned long color);
+
+/** @brief Empties the list of primitives */
+void glcdBandClear(void);
+
+/**
+ * @brief Adds a solid rectangle to the list
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param index Palette index of the rectangle's color
+ * @return 0 if the list is full, otherwise 1
+ */
+unsigned char glcdBandRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned char index
+);
+
+/**
+ * @brief Adds a string of text on a single line to the list
+ * @param x x-position of the first character cell
+ * @param y y-position of the first character cell
+ * @param str The null-terminated string. Only the pointer is stored, so the
+ *        string must not change until the list is cleared
+ * @param fg Palette index of the characters
+ * @param bg Palette index of the rest of the cells, or BAND_TRANSPARENT
+ * @return 0 if the list is full, otherwise 1
+ */
+unsigned char glcdBandText(
+    unsigned char x,
+    unsigned char y,
+    const char* str,
+    unsigned char fg,
+    unsigned char bg
+);
+
+/**
+ * @brief Renders the list to the display, band by band, over the rows
+ *        [YS, YE) across the full width of the band buffer
+ * @param YS First row to render
+ * @param YE End row to render (exclusive, max: GLCD_SIZE_VERT)
+ */
+void glcdBandRender(unsigned char YS, unsigned char YE);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_BAND_H */
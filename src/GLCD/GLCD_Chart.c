@@ -0,0 +1,130 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Chart
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Chart.h"
+
+/***************************** Private Variables *****************************/
+static unsigned char traces = 0;
+static unsigned long traceColors[CHART_MAX_TRACES];
+static unsigned char lastValue[CHART_MAX_TRACES];
+static unsigned long background = 0;
+static unsigned char scrolling = 0;
+static unsigned char started = 0; /**< 1 once the first sample is in */
+static unsigned char cursor = 0;
+static glcd_axis_e timeAxis = AXIS_X;
+
+// Range of values drawn on each line, so it can be erased next time around.
+// A line with lo > hi is blank
+static unsigned char lineLo[CHART_LINES];
+static unsigned char lineHi[CHART_LINES];
+
+/***************************** Public Functions ******************************/
+void glcdChartInit(
+    unsigned char numTraces,
+    const unsigned long* colors,
+    unsigned long bg,
+    unsigned char useScroll
+)
+{
+    traces = (numTraces < CHART_MAX_TRACES) ? numTraces : CHART_MAX_TRACES;
+    for(unsigned char i = 0; i < traces; i++){
+        traceColors[i] = colors[i];
+    }
+    background = bg;
+    scrolling = useScroll;
+    started = 0;
+    cursor = 0;
+    timeAxis = glcdGetScrollAxis();
+    for(unsigned char t = 0; t < CHART_LINES; t++){
+        lineLo[t] = 0xFF;
+        lineHi[t] = 0;
+    }
+    
+    glcdDrawRectangle(0, GLCD_SIZE_HORZ, 0, GLCD_SIZE_VERT, background);
+    if(scrolling){
+        glcdEnableScroll();
+    }
+    else{
+        glcd_noron(); // Cancels any scroll offset left from before
+    }
+}
+
+void glcdChartAddSample(const unsigned char* values){
+    if(traces == 0){
+        return;
+    }
+    
+    // The span of each trace on this line, and of everything together
+    unsigned char lo[CHART_MAX_TRACES];
+    unsigned char hi[CHART_MAX_TRACES];
+    unsigned char newLo = 0xFF;
+    unsigned char newHi = 0;
+    for(unsigned char i = 0; i < traces; i++){
+        unsigned char v = (values[i] < CHART_LINES) ?
+            values[i] : CHART_LINES - 1;
+        unsigned char prev = started ? lastValue[i] : v;
+        lo[i] = (prev < v) ? prev : v;
+        hi[i] = (prev < v) ? v : prev;
+        lastValue[i] = v;
+        if(lo[i] < newLo){
+            newLo = lo[i];
+        }
+        if(hi[i] > newHi){
+            newHi = hi[i];
+        }
+    }
+    started = 1;
+    
+    // One window covering both what's there and what's new
+    unsigned char first = (lineLo[cursor] < newLo) ? lineLo[cursor] : newLo;
+    unsigned char last = (lineHi[cursor] > newHi) ? lineHi[cursor] : newHi;
+    lineLo[cursor] = newLo;
+    lineHi[cursor] = newHi;
+    
+    unsigned char visible;
+    if(timeAxis == AXIS_Y){
+        visible = glcdSetWindow(first, last + 1, cursor, cursor + 1);
+    }
+    else{
+        visible = glcdSetWindow(cursor, cursor + 1, first, last + 1);
+    }
+    if(visible){
+        unsigned long runColor = 0;
+        unsigned short runLength = 0;
+        for(unsigned char v = first; ; v++){
+            unsigned long color = background;
+            for(unsigned char i = 0; i < traces; i++){
+                if((v >= lo[i]) && (v <= hi[i])){
+                    color = traceColors[i];
+                }
+            }
+            if((runLength > 0) && (color != runColor)){
+                glcdWritePixels(runColor, runLength);
+                runLength = 0;
+            }
+            runColor = color;
+            runLength++;
+            if(v == last){
+                break;
+            }
+        }
+        glcdWritePixels(runColor, runLength);
+        glcdEndPixels();
+    }
+    
+    cursor = (cursor == CHART_LINES - 1) ? 0 : cursor + 1;
+    if(scrolling){
+        // The line just written was at the start; it's now shown at the end
+        glcdScrollTo(cursor);
+    }
+}
+
+unsigned char glcdChartGetCursor(void){
+    return cursor;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Chart
+ * @brief Scrolling strip chart for plotting samples as they come in
+ * @details The chart covers the whole display. Time runs along the axis
+ *          reported by glcdGetScrollAxis, one line per sample, and values run
+ *          along the other axis. Each sample only redraws the line it goes on:
+ *          one window spanning what was drawn on that line last time around
+ *          and the new span of every trace. Each trace's span joins its
+ *          previous value to the new one, so fast changes stay connected.
+ *
+ *          With hardware scrolling, the newest sample always appears at the
+ *          end of the display and older ones move toward the start. Without
+ *          it, samples are written at a cursor that wraps around.
+ *
+ *          A typical sample (a span of about ten pixels) is around 40 bytes,
+ *          which at FOSC / 4 with a 10 MHz crystal comes to about 0.45 ms
+ *          (see spi_byte_cycles)
+ * @{
+ */
+
+#ifndef GLCD_CHART_H
+#define GLCD_CHART_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Macros ***********************************/
+/** @brief Most traces a chart can have */
+#define CHART_MAX_TRACES 4
+
+/** @brief Lines along the time axis */
+#define CHART_LINES 128
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Clears the display and starts a new chart
+ * @param numTraces Number of traces (max: CHART_MAX_TRACES)
+ * @param colors Color of each trace. Later traces are drawn over earlier ones
+ * @param bg Background color
+ * @param useScroll 1 to scroll the display with each sample, 0 to write
+ *        samples at a wrapping cursor instead. With 0, the display is put in
+ *        normal mode (glcd_noron), which cancels any scrolling and partial
+ *        mode left from before
+ */
+void glcdChartInit(
+    unsigned char numTraces,
+    const unsigned long* colors,
+    unsigned long bg,
+    unsigned char useScroll
+);
+
+/**
+ * @brief Plots a sample of every trace
+ * @param values Value of each trace, as a pixel position along the value axis
+ *        (max: CHART_LINES - 1)
+ */
+void glcdChartAddSample(const unsigned char* values);
+
+/**
+ * @brief Gets the position of the next sample along the time axis
+ * @return The line the next sample is written to
+ */
+unsigned char glcdChartGetCursor(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_CHART_H */
@@ -0,0 +1,266 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Console
+ */
+
+/********************************* Includes **********************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include "GLCD_Console.h"
+
+/******************************** Constants **********************************/
+static const unsigned long PALETTE[16] = {
+    0x000000, // CONSOLE_BLACK
+    0xFF0000, // CONSOLE_RED
+    0x00FF00, // CONSOLE_GREEN
+    0xFFFF00, // CONSOLE_YELLOW
+    0x0000FF, // CONSOLE_BLUE
+    0xFF00FF, // CONSOLE_MAGENTA
+    0x00FFFF, // CONSOLE_CYAN
+    0xFFFFFF, // CONSOLE_WHITE
+    0x808080, // CONSOLE_GREY
+    0xFF8C00, // CONSOLE_ORANGE
+    0x80FF80, // CONSOLE_LIGHT_GREEN
+    0xFFFF80, // CONSOLE_LIGHT_YELLOW
+    0x8080FF, // CONSOLE_LIGHT_BLUE
+    0x4B0082, // CONSOLE_INDIGO
+    0x9400D3, // CONSOLE_VIOLET
+    0x404040  // CONSOLE_DARK_GREY
+};
+
+#define DIRTY_BYTES ((CONSOLE_COLS + 7) / 8) /**< Change flags per line */
+
+/***************************** Private Variables *****************************/
+// Cell map. Rows are stored in the order they are placed in display RAM,
+// which is rotated by topRow when hardware scrolling is in use. Attributes
+// hold the foreground color in the upper nibble and background in the lower
+static char cells[CONSOLE_ROWS][CONSOLE_COLS];
+static unsigned char attrs[CONSOLE_ROWS][CONSOLE_COLS];
+static unsigned char dirty[CONSOLE_ROWS][DIRTY_BYTES];
+
+static unsigned char topRow = 0; /**< Stored row shown at the top */
+static unsigned char cursorRow = 0; /**< Line of the cursor (0 is the top) */
+static unsigned char cursorCol = 0; /**< Cell of the cursor within the line */
+static unsigned char attr = (CONSOLE_WHITE << 4) | CONSOLE_BLACK;
+static unsigned char hardwareScroll = 0; /**< 1 if new lines scroll the panel */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Converts a line on screen into the row it's stored in
+ * @param row Line (0 is the top)
+ * @return Index into the cell map
+ */
+static unsigned char consoleStoredRow(unsigned char row){
+    row += topRow;
+    return (row >= CONSOLE_ROWS) ? row - CONSOLE_ROWS : row;
+}
+
+/**
+ * @brief Changes a cell in the map, flagging it for redraw if it will look
+ *        different. Blank cells look the same as long as the background does
+ * @param r Stored row of the cell
+ * @param col Cell within the row
+ * @param c The character
+ * @param a The attributes (colors)
+ */
+static void consoleSetCell(
+    unsigned char r,
+    unsigned char col,
+    char c,
+    unsigned char a
+)
+{
+    char oldC = cells[r][col];
+    unsigned char oldA = attrs[r][col];
+    if(oldC == c){
+        if(oldA == a){
+            return;
+        }
+        if((c == ' ') && ((oldA & 0x0F) == (a & 0x0F))){
+            return;
+        }
+    }
+    
+    cells[r][col] = c;
+    attrs[r][col] = a;
+    dirty[r][col >> 3] |= 1 << (col & 7);
+}
+
+/**
+ * @brief Redraws the changed cells of a stored row. Each run of consecutive
+ *        changed cells is drawn in one window
+ * @param r Stored row
+ */
+static void consoleFlushRow(unsigned char r){
+    unsigned char y = r * FONT_CHAR_HEIGHT;
+    unsigned char col = 0;
+    
+    while(col < CONSOLE_COLS){
+        if((dirty[r][col >> 3] & (1 << (col & 7))) == 0){
+            col++;
+            continue;
+        }
+        
+        unsigned char first = col;
+        while((col < CONSOLE_COLS) && (dirty[r][col >> 3] & (1 << (col & 7)))){
+            col++;
+        }
+        
+        unsigned char XS = first * FONT_CHAR_WIDTH;
+        unsigned char XE = col * FONT_CHAR_WIDTH;
+        if(glcdSetWindow(XS, XE, y, y + FONT_CHAR_HEIGHT)){
+            for(unsigned char i = first; i < col; i++){
+                fontWriteChar(
+                    cells[r][i],
+                    PALETTE[attrs[r][i] >> 4],
+                    PALETTE[attrs[r][i] & 0x0F]
+                );
+            }
+            glcdEndPixels();
+        }
+    }
+    
+    for(unsigned char i = 0; i < DIRTY_BYTES; i++){
+        dirty[r][i] = 0;
+    }
+}
+
+/** @brief Makes room for a new line at the bottom of the console */
+static void consoleNewLine(void){
+    if(cursorRow < CONSOLE_ROWS - 1){
+        cursorRow++;
+        return;
+    }
+    
+    if(hardwareScroll){
+        // The stored row at the top becomes the new bottom line. Blank it
+        // while it's on its way off the top, then scroll it into place
+        unsigned char r = topRow;
+        for(unsigned char col = 0; col < CONSOLE_COLS; col++){
+            consoleSetCell(r, col, ' ', attr);
+        }
+        consoleFlushRow(r);
+        topRow = (topRow == CONSOLE_ROWS - 1) ? 0 : topRow + 1;
+        glcdScrollTo(topRow * FONT_CHAR_HEIGHT);
+    }
+    else{
+        // Shift the map up a line. Only the cells that end up looking
+        // different are flagged for redraw
+        for(unsigned char r = 0; r < CONSOLE_ROWS - 1; r++){
+            for(unsigned char col = 0; col < CONSOLE_COLS; col++){
+                consoleSetCell(r, col, cells[r + 1][col], attrs[r + 1][col]);
+            }
+        }
+        for(unsigned char col = 0; col < CONSOLE_COLS; col++){
+            consoleSetCell(CONSOLE_ROWS - 1, col, ' ', attr);
+        }
+    }
+}
+
+/***************************** Public Functions ******************************/
+void glcdConsoleInit(void){
+    for(unsigned char r = 0; r < CONSOLE_ROWS; r++){
+        for(unsigned char col = 0; col < CONSOLE_COLS; col++){
+            cells[r][col] = ' ';
+            attrs[r][col] = attr;
+        }
+        for(unsigned char i = 0; i < DIRTY_BYTES; i++){
+            dirty[r][i] = 0;
+        }
+    }
+    topRow = 0;
+    cursorRow = 0;
+    cursorCol = 0;
+    
+    glcdDrawRectangle(
+        0,
+        GLCD_SIZE_HORZ,
+        0,
+        GLCD_SIZE_VERT,
+        PALETTE[attr & 0x0F]
+    );
+    
+    // Lines are stacked along the y-axis, so hardware scrolling can only be
+    // used when that is the axis the panel scrolls along. Otherwise, any
+    // scroll offset left from before must be cancelled
+    hardwareScroll = (glcdGetScrollAxis() == AXIS_Y) ? 1 : 0;
+    if(hardwareScroll){
+        glcdEnableScroll();
+    }
+    else{
+        glcd_noron();
+    }
+}
+
+void glcdConsoleSetColors(console_color_e fg, console_color_e bg){
+    attr = ((fg & 0x0F) << 4) | (bg & 0x0F);
+}
+
+void glcdConsoleClear(void){
+    for(unsigned char r = 0; r < CONSOLE_ROWS; r++){
+        for(unsigned char col = 0; col < CONSOLE_COLS; col++){
+            consoleSetCell(r, col, ' ', attr);
+        }
+    }
+    cursorRow = 0;
+    cursorCol = 0;
+}
+
+void glcdConsoleSetCursor(unsigned char row, unsigned char col){
+    cursorRow = (row < CONSOLE_ROWS) ? row : CONSOLE_ROWS - 1;
+    cursorCol = (col < CONSOLE_COLS) ? col : CONSOLE_COLS - 1;
+}
+
+void glcdConsolePutc(char c){
+    switch(c){
+        case '\n':
+            cursorCol = 0;
+            consoleNewLine();
+            break;
+        case '\r':
+            cursorCol = 0;
+            break;
+        case '\b':
+            if(cursorCol > 0){
+                cursorCol--;
+            }
+            break;
+        default:
+            if(cursorCol == CONSOLE_COLS){
+                cursorCol = 0;
+                consoleNewLine();
+            }
+            consoleSetCell(consoleStoredRow(cursorRow), cursorCol, c, attr);
+            cursorCol++; // Wraps when the next character is written
+            break;
+    }
+}
+
+void glcdConsolePuts(const char* str){
+    while(*str != '\0'){
+        glcdConsolePutc(*str++);
+    }
+}
+
+int glcdConsolePrintf(const char* fmt, ...){
+    char buffer[CONSOLE_PRINTF_BUFFER_SIZE];
+    
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    
+    glcdConsolePuts(buffer);
+    glcdConsoleFlush();
+    
+    return (len < (int)sizeof(buffer)) ? len : (int)sizeof(buffer) - 1;
+}
+
+void glcdConsoleFlush(void){
+    for(unsigned char r = 0; r < CONSOLE_ROWS; r++){
+        consoleFlushRow(r);
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Console
+ * @brief Character-cell text console for the GLCD
+ * @details The console keeps a map of the characters and colors on screen,
+ *          and only redraws the cells that changed. New lines are made by
+ *          hardware scrolling when the origin allows it (see
+ *          glcdGetScrollAxis), so the lines that are already on screen don't
+ *          have to be sent again. Otherwise, the cell map is shifted and only
+ *          the cells whose contents changed are redrawn.
+ *
+ *          The cell map takes 2 bytes per cell, plus 1 bit per cell to track
+ *          changes (about 720 bytes for the full screen)
+ * @{
+ */
+
+#ifndef GLCD_CONSOLE_H
+#define GLCD_CONSOLE_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+#include "GLCD_Font.h"
+
+/********************************** Macros ***********************************/
+#define CONSOLE_COLS (128 / FONT_CHAR_WIDTH)  /**< 21 cells per line   */
+#define CONSOLE_ROWS (128 / FONT_CHAR_HEIGHT) /**< 16 lines            */
+
+/** @brief Longest string glcdConsolePrintf can print in one call */
+#define CONSOLE_PRINTF_BUFFER_SIZE 64
+
+/********************************** Types ************************************/
+/** @brief Colors available for console text and backgrounds */
+typedef enum{
+    CONSOLE_BLACK,
+    CONSOLE_RED,
+    CONSOLE_GREEN,
+    CONSOLE_YELLOW,
+    CONSOLE_BLUE,
+    CONSOLE_MAGENTA,
+    CONSOLE_CYAN,
+    CONSOLE_WHITE,
+    CONSOLE_GREY,
+    CONSOLE_ORANGE,
+    CONSOLE_LIGHT_GREEN,
+    CONSOLE_LIGHT_YELLOW,
+    CONSOLE_LIGHT_BLUE,
+    CONSOLE_INDIGO,
+    CONSOLE_VIOLET,
+    CONSOLE_DARK_GREY
+}console_color_e;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Clears the display and the cell map, and homes the cursor. If the
+ *        current origin supports it, hardware scrolling is enabled. If not,
+ *        the display is put in normal mode (glcd_noron), which cancels any
+ *        scrolling and partial mode left from before
+ * @note Call again after changing the origin with glcdSetOrigin
+ */
+void glcdConsoleInit(void);
+
+/**
+ * @brief Sets the colors used for the characters written from now on
+ * @param fg Color of the characters
+ * @param bg Color of the background of the cells
+ */
+void glcdConsoleSetColors(console_color_e fg, console_color_e bg);
+
+/**
+ * @brief Clears the console with the current background color and homes the
+ *        cursor. Only cells that weren't already blank are redrawn
+ */
+void glcdConsoleClear(void);
+
+/**
+ * @brief Moves the cursor
+ * @param row Line (0 is the top)
+ * @param col Cell within the line (0 is the first)
+ */
+void glcdConsoleSetCursor(unsigned char row, unsigned char col);
+
+/**
+ * @brief Writes a character at the cursor, and advances the cursor. Lines
+ *        wrap at the edge of the display. Handles '\n' (new line), '\r'
+ *        (return to start of line), and '\b' (back one cell)
+ * @note Nothing is sent to the display until glcdConsoleFlush is called,
+ *       except when the console has to scroll
+ * @param c The character
+ */
+void glcdConsolePutc(char c);
+
+/**
+ * @brief Writes a string at the cursor (see glcdConsolePutc)
+ * @param str The null-terminated string
+ */
+void glcdConsolePuts(const char* str);
+
+/**
+ * @brief Formats and writes a string at the cursor, then flushes the changes
+ *        to the display
+ * @param fmt printf-style format string
+ * @return Number of characters written. Output beyond
+ *         CONSOLE_PRINTF_BUFFER_SIZE - 1 characters is dropped
+ */
+int glcdConsolePrintf(const char* fmt, ...);
+
+/** @brief Redraws the cells that changed since the last flush */
+void glcdConsoleFlush(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_CONSOLE_H */
@@ -0,0 +1,132 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Dirty
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Dirty.h"
+
+/***************************** Private Variables *****************************/
+// One byte per row of tiles, with one bit per tile along the x-axis
+static unsigned char dirtyTiles[DIRTY_TILES];
+static glcd_render_fn_t renderer = 0;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Converts a range of pixels into the range of tiles it touches
+ * @param start First pixel
+ * @param end End pixel (exclusive, greater than start)
+ * @param first First tile
+ * @param last Last tile (inclusive)
+ */
+static void dirtyTileRange(
+    unsigned char start,
+    unsigned char end,
+    unsigned char* first,
+    unsigned char* last
+)
+{
+    *first = start / DIRTY_TILE_SIZE;
+    *last = (end - 1) / DIRTY_TILE_SIZE;
+    if(*last >= DIRTY_TILES){
+        *last = DIRTY_TILES - 1;
+    }
+}
+
+/**
+ * @brief Builds the mask for a run of tiles within a row
+ * @param first First tile
+ * @param last Last tile (inclusive)
+ * @return Bits first through last set
+ */
+static unsigned char dirtyRowMask(unsigned char first, unsigned char last){
+    return (unsigned char)((0xFF << first) & (0xFF >> (7 - last)));
+}
+
+/***************************** Public Functions ******************************/
+void glcdSetDirtyRenderer(glcd_render_fn_t render){
+    renderer = render;
+}
+
+void glcdMarkDirty(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+)
+{
+    if((XE <= XS) || (YE <= YS) ||
+       (XS >= DIRTY_TILES * DIRTY_TILE_SIZE) ||
+       (YS >= DIRTY_TILES * DIRTY_TILE_SIZE)){
+        return;
+    }
+    
+    unsigned char tx0, tx1, ty0, ty1;
+    dirtyTileRange(XS, XE, &tx0, &tx1);
+    dirtyTileRange(YS, YE, &ty0, &ty1);
+    
+    unsigned char mask = dirtyRowMask(tx0, tx1);
+    for(unsigned char ty = ty0; ty <= ty1; ty++){
+        dirtyTiles[ty] |= mask;
+    }
+}
+
+void glcdMarkAllDirty(void){
+    for(unsigned char ty = 0; ty < DIRTY_TILES; ty++){
+        dirtyTiles[ty] = (unsigned char)(0xFF >> (8 - DIRTY_TILES));
+    }
+}
+
+unsigned char glcdIsDirty(void){
+    for(unsigned char ty = 0; ty < DIRTY_TILES; ty++){
+        if(dirtyTiles[ty] != 0){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+unsigned char glcdFlushDirty(void){
+    unsigned char numCalls = 0;
+    
+    // Greedily cover the marked tiles with rectangles: take the leftmost run
+    // of marked tiles in the topmost marked row, then extend it down for as
+    // long as the rows below have the whole run marked too
+    for(unsigned char ty = 0; ty < DIRTY_TILES; ty++){
+        while(dirtyTiles[ty] != 0){
+            unsigned char tx0 = 0;
+            while((dirtyTiles[ty] & (1 << tx0)) == 0){
+                tx0++;
+            }
+            unsigned char tx1 = tx0;
+            while((tx1 + 1 < DIRTY_TILES) &&
+                  (dirtyTiles[ty] & (1 << (tx1 + 1)))){
+                tx1++;
+            }
+            unsigned char mask = dirtyRowMask(tx0, tx1);
+            
+            unsigned char ty1 = ty;
+            while((ty1 + 1 < DIRTY_TILES) &&
+                  ((dirtyTiles[ty1 + 1] & mask) == mask)){
+                ty1++;
+            }
+            for(unsigned char t = ty; t <= ty1; t++){
+                dirtyTiles[t] &= ~mask;
+            }
+            
+            if(renderer != 0){
+                renderer(
+                    tx0 * DIRTY_TILE_SIZE,
+                    (tx1 + 1) * DIRTY_TILE_SIZE,
+                    ty * DIRTY_TILE_SIZE,
+                    (ty1 + 1) * DIRTY_TILE_SIZE
+                );
+                numCalls++;
+            }
+        }
+    }
+    return numCalls;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Dirty
+ * @brief Tracks which parts of the screen changed, so that only those are
+ *        redrawn
+ * @details The visible area is divided into DIRTY_TILES x DIRTY_TILES tiles
+ *          of DIRTY_TILE_SIZE pixels square, with one bit each (8 bytes of RAM
+ *          in total). The application marks the area it changed, and
+ *          glcdFlushDirty calls the render callback for the marked tiles.
+ *          Marked tiles next to each other are merged into larger
+ *          rectangles first, so the callback is called as few times as
+ *          possible and fewer window setups are sent.
+ *
+ *          Marking is left to the application on purpose. An area needs
+ *          redrawing when the data shown there changes (a value, a sprite's
+ *          position), which only the application knows. The drawing
+ *          functions have already updated display RAM when they return, and
+ *          the render callback is made of drawing calls, so marking from them
+ *          would only redraw what was just drawn. Mark areas when their data
+ *          changes, and draw them only from the callback, which must not mark
+ *          tiles itself
+ * @{
+ */
+
+#ifndef GLCD_DIRTY_H
+#define GLCD_DIRTY_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Macros ***********************************/
+/** @brief Width and height of a tile, in pixels */
+#define DIRTY_TILE_SIZE 16
+
+/** @brief Tiles along each axis (max: 8) */
+#define DIRTY_TILES (128 / DIRTY_TILE_SIZE)
+
+/********************************** Types ************************************/
+/**
+ * @brief Redraws a rectangle of the screen
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ */
+typedef void (*glcd_render_fn_t)(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+);
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets the function glcdFlushDirty calls to redraw the marked areas
+ * @param render The render callback
+ */
+void glcdSetDirtyRenderer(glcd_render_fn_t render);
+
+/**
+ * @brief Marks every tile a rectangle touches as needing to be redrawn. Call
+ *        it when the contents of that area change, not from the render
+ *        callback
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ */
+void glcdMarkDirty(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+);
+
+/** @brief Marks the whole screen as needing to be redrawn */
+void glcdMarkAllDirty(void);
+
+/**
+ * @brief Checks whether anything is marked
+ * @return 1 if any tile is marked, otherwise 0
+ */
+unsigned char glcdIsDirty(void);
+
+/**
+ * @brief Redraws the marked tiles through the render callback, and clears
+ *        the marks
+ * @return Number of times the callback was called
+ */
+unsigned char glcdFlushDirty(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_DIRTY_H */
@@ -0,0 +1,429 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_DrawList
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_DrawList.h"
+
+/********************************** Types ************************************/
+/** @brief A rectangle in the list. Removed entries have XE == XS */
+typedef struct{
+    unsigned char XS;
+    unsigned char XE;
+    unsigned char YS;
+    unsigned char YE;
+    unsigned long color;
+}drawlist_item_t;
+
+/** @brief A visible part of a list entry */
+typedef struct{
+    unsigned char XS;
+    unsigned char XE;
+    unsigned char YS;
+    unsigned char YE;
+    unsigned char item; /**< Index of the entry it's part of */
+}drawlist_fragment_t;
+
+/***************************** Private Variables *****************************/
+static drawlist_item_t items[DRAWLIST_MAX_ITEMS];
+static unsigned char numItems = 0;
+static drawlist_fragment_t fragments[DRAWLIST_MAX_FRAGMENTS];
+static unsigned char numFragments = 0;
+static drawlist_stats_t stats = {0, 0, 0, 0, 0};
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Computes how many bytes it takes to draw a rectangle
+ * @param item The rectangle
+ * @return Window setup plus pixel data, in the current pixel format
+ */
+static unsigned long drawlistCost(const drawlist_item_t* item){
+    unsigned short numPixels = (item->XE - item->XS) * (item->YE - item->YS);
+    unsigned long pixelBytes;
+    switch(glcdGetCOLMOD()){
+        case 12:
+            pixelBytes = numPixels + ((numPixels + 1UL) >> 1);
+            break;
+        case 16:
+            pixelBytes = numPixels * 2UL;
+            break;
+        default:
+            pixelBytes = numPixels * 3UL;
+            break;
+    }
+    return GLCD_WINDOW_SETUP_BYTES + pixelBytes;
+}
+
+/**
+ * @brief Checks whether two rectangles share any pixels
+ * @return 1 if they do, otherwise 0
+ */
+static unsigned char drawlistOverlaps(
+    const drawlist_item_t* a,
+    const drawlist_item_t* b
+)
+{
+    return (a->XS < b->XE) && (b->XS < a->XE) &&
+           (a->YS < b->YE) && (b->YS < a->YE);
+}
+
+/**
+ * @brief Checks whether a fragment shares any pixels with a list entry
+ * @return 1 if it does, otherwise 0
+ */
+static unsigned char drawlistFragmentOverlaps(
+    const drawlist_fragment_t* f,
+    const drawlist_item_t* item
+)
+{
+    return (f->XS < item->XE) && (item->XS < f->XE) &&
+           (f->YS < item->YE) && (item->YS < f->YE);
+}
+
+/**
+ * @brief Checks whether one rectangle covers all of another
+ * @return 1 if outer contains inner, otherwise 0
+ */
+static unsigned char drawlistContains(
+    const drawlist_item_t* outer,
+    const drawlist_item_t* inner
+)
+{
+    return (outer->XS <= inner->XS) && (outer->XE >= inner->XE) &&
+           (outer->YS <= inner->YS) && (outer->YE >= inner->YE);
+}
+
+/**
+ * @brief Computes the union of two rectangles of the same color, if the union
+ *        is itself a rectangle
+ * @param a The first rectangle
+ * @param b The second rectangle
+ * @param merged The union
+ * @return 1 if the rectangles can be merged, otherwise 0
+ */
+static unsigned char drawlistUnion(
+    const drawlist_item_t* a,
+    const drawlist_item_t* b,
+    drawlist_item_t* merged
+)
+{
+    if(a->color != b->color){
+        return 0;
+    }
+    
+    if(drawlistContains(a, b)){
+        *merged = *a;
+        return 1;
+    }
+    if(drawlistContains(b, a)){
+        *merged = *b;
+        return 1;
+    }
+
+    *merged = *a;
+    if((a->XS == b->XS) && (a->XE == b->XE) &&
+       (a->YS <= b->YE) && (b->YS <= a->YE)){
+        // Stacked along y, touching or overlapping
+        merged->YS = (a->YS < b->YS) ? a->YS : b->YS;
+        merged->YE = (a->YE > b->YE) ? a->YE : b->YE;
+        return 1;
+    }
+    if((a->YS == b->YS) && (a->YE == b->YE) &&
+       (a->XS <= b->XE) && (b->XS <= a->XE)){
+        // Side by side along x, touching or overlapping
+        merged->XS = (a->XS < b->XS) ? a->XS : b->XS;
+        merged->XE = (a->XE > b->XE) ? a->XE : b->XE;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Checks whether any rectangle drawn between two list entries overlaps
+ *        a rectangle
+ * @param first Index of the first entry
+ * @param last Index of the last entry
+ * @param rect The rectangle
+ * @return 1 if one does, otherwise 0
+ */
+static unsigned char drawlistOverlapsBetween(
+    unsigned char first,
+    unsigned char last,
+    const drawlist_item_t* rect
+)
+{
+    for(unsigned char k = first + 1; k < last; k++){
+        if((items[k].XE != items[k].XS) && drawlistOverlaps(&items[k], rect)){
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Removes rectangles that are covered by a later one
+ * @return 1 if anything was removed, otherwise 0
+ */
+static unsigned char drawlistDropCovered(void){
+    unsigned char changed = 0;
+    for(unsigned char i = 0; i < numItems; i++){
+        if(items[i].XE == items[i].XS){
+            continue;
+        }
+        for(unsigned char j = i + 1; j < numItems; j++){
+            if((items[j].XE != items[j].XS) &&
+               drawlistContains(&items[j], &items[i])){
+                items[i].XE = items[i].XS;
+                changed = 1;
+                break;
+            }
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Merges pairs of same-color rectangles whose union is a rectangle.
+ *        Merging moves one of them past the entries recorded in between, so
+ *        it's only done if that one doesn't overlap any of them
+ * @return 1 if anything was merged, otherwise 0
+ */
+static unsigned char drawlistMerge(void){
+    unsigned char changed = 0;
+    drawlist_item_t merged;
+    for(unsigned char i = 0; i < numItems; i++){
+        if(items[i].XE == items[i].XS){
+            continue;
+        }
+        for(unsigned char j = i + 1; j < numItems; j++){
+            if((items[j].XE == items[j].XS) ||
+               !drawlistUnion(&items[i], &items[j], &merged)){
+                continue;
+            }
+            
+            if(!drawlistOverlapsBetween(i, j, &items[i])){
+                // Draw the union where the later one was
+                items[j] = merged;
+                items[i].XE = items[i].XS;
+                changed = 1;
+                break;
+            }
+            if(!drawlistOverlapsBetween(i, j, &items[j])){
+                // Draw the union where the earlier one was
+                items[i] = merged;
+                items[j].XE = items[j].XS;
+                changed = 1;
+            }
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Adds a fragment
+ * @return 0 if there's no room for it, otherwise 1
+ */
+static unsigned char drawlistPushFragment(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned char item
+)
+{
+    if(numFragments == DRAWLIST_MAX_FRAGMENTS){
+        return 0;
+    }
+    drawlist_fragment_t* f = &fragments[numFragments++];
+    f->XS = XS;
+    f->XE = XE;
+    f->YS = YS;
+    f->YE = YE;
+    f->item = item;
+    return 1;
+}
+
+/**
+ * @brief Replaces a fragment by the parts of it outside a later entry: the
+ *        bands above and below it, and the parts left and right of it
+ * @param f The fragment, which is marked as removed
+ * @param o The later entry, which must overlap the fragment
+ * @return 0 if there's no room for the parts, otherwise 1
+ */
+static unsigned char drawlistSplitFragment(
+    drawlist_fragment_t* f,
+    const drawlist_item_t* o
+)
+{
+    drawlist_fragment_t old = *f;
+    f->XE = f->XS;
+    
+    unsigned char YS = old.YS;
+    unsigned char YE = old.YE;
+    if(old.YS < o->YS){
+        if(!drawlistPushFragment(old.XS, old.XE, old.YS, o->YS, old.item)){
+            return 0;
+        }
+        YS = o->YS;
+    }
+    if(o->YE < old.YE){
+        if(!drawlistPushFragment(old.XS, old.XE, o->YE, old.YE, old.item)){
+            return 0;
+        }
+        YE = o->YE;
+    }
+    if(old.XS < o->XS){
+        if(!drawlistPushFragment(old.XS, o->XS, YS, YE, old.item)){
+            return 0;
+        }
+    }
+    if(o->XE < old.XE){
+        if(!drawlistPushFragment(o->XE, old.XE, YS, YE, old.item)){
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Breaks every entry into the fragments of it that aren't covered by
+ *        a later entry. The fragments don't overlap, so every pixel is sent
+ *        once no matter which order they're sent in
+ * @return 0 if there are more fragments than fit, otherwise 1
+ */
+static unsigned char drawlistRemoveOverdraw(void){
+    numFragments = 0;
+    for(unsigned char i = 0; i < numItems; i++){
+        if(items[i].XE == items[i].XS){
+            continue;
+        }
+        
+        unsigned char first = numFragments;
+        if(!drawlistPushFragment(
+                items[i].XS, items[i].XE, items[i].YS, items[i].YE, i)){
+            return 0;
+        }
+        
+        for(unsigned char j = i + 1; j < numItems; j++){
+            const drawlist_item_t* o = &items[j];
+            if(o->XE == o->XS){
+                continue;
+            }
+            
+            // Split the fragments of this entry that the later one covers.
+            // New parts are added past end and don't overlap it
+            unsigned char end = numFragments;
+            for(unsigned char k = first; k < end; k++){
+                if(drawlistFragmentOverlaps(&fragments[k], o) &&
+                   !drawlistSplitFragment(&fragments[k], o)){
+                    return 0;
+                }
+            }
+            
+            // Compact out the removed fragments
+            unsigned char n = first;
+            for(unsigned char k = first; k < numFragments; k++){
+                if(fragments[k].XE != fragments[k].XS){
+                    fragments[n++] = fragments[k];
+                }
+            }
+            numFragments = n;
+            if(numFragments == first){
+                break; // Nothing of this entry is visible
+            }
+        }
+    }
+    return 1;
+}
+
+/***************************** Public Functions ******************************/
+void glcdDrawListRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+)
+{
+    if((XE <= XS) || (YE <= YS)){
+        return;
+    }
+    if(numItems == DRAWLIST_MAX_ITEMS){
+        glcdDrawListFlush();
+    }
+    
+    drawlist_item_t* item = &items[numItems++];
+    item->XS = XS;
+    item->XE = XE;
+    item->YS = YS;
+    item->YE = YE;
+    item->color = color;
+    
+    stats.itemsRecorded++;
+    stats.bytesRecorded += drawlistCost(item);
+}
+
+void glcdDrawListFlush(void){
+    // Keep going until neither pass finds anything, since each can open up
+    // opportunities for the other
+    unsigned char changed;
+    do{
+        changed = drawlistDropCovered();
+        changed |= drawlistMerge();
+    }while(changed);
+    
+    if(drawlistRemoveOverdraw()){
+        for(unsigned char k = 0; k < numFragments; k++){
+            drawlist_fragment_t* f = &fragments[k];
+            drawlist_item_t piece = items[f->item];
+            piece.XS = f->XS;
+            piece.XE = f->XE;
+            piece.YS = f->YS;
+            piece.YE = f->YE;
+            glcdDrawRectangle(
+                piece.XS,
+                piece.XE,
+                piece.YS,
+                piece.YE,
+                piece.color
+            );
+            stats.itemsSent++;
+            stats.bytesSent += drawlistCost(&piece);
+        }
+        numItems = 0;
+        return;
+    }
+    
+    // Too many fragments: send the entries as they are, in order
+    stats.fallbacks++;
+    for(unsigned char i = 0; i < numItems; i++){
+        drawlist_item_t* item = &items[i];
+        if(item->XE == item->XS){
+            continue;
+        }
+        glcdDrawRectangle(item->XS, item->XE, item->YS, item->YE, item->color);
+        stats.itemsSent++;
+        stats.bytesSent += drawlistCost(item);
+    }
+    numItems = 0;
+}
+
+void glcdDrawListClear(void){
+    numItems = 0;
+}
+
+void glcdDrawListGetStats(drawlist_stats_t* dst){
+    *dst = stats;
+}
+
+void glcdDrawListResetStats(void){
+    stats.itemsRecorded = 0;
+    stats.itemsSent = 0;
+    stats.bytesRecorded = 0;
+    stats.bytesSent = 0;
+    stats.fallbacks = 0;
+}
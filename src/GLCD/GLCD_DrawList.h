@@ -0,0 +1,87 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_DrawList
+ * @brief Deferred draw list that optimizes rectangles before sending them
+ * @details Instead of being sent right away, rectangles are recorded into a
+ *          list. When the list is flushed:
+ *           -# Rectangles that are completely covered by a later rectangle are
+ *              dropped, since they would be overwritten anyway
+ *           -# Rectangles of the same color that together form a rectangle
+ *              (adjacent or overlapping) are merged, saving a window setup,
+ *              and the pixels of any overlap
+ *           -# Rectangles that are partly covered by later ones are broken up
+ *              into their visible parts, so that every pixel on the screen is
+ *              sent at most once per flush
+ *
+ *          The result on screen is the same as drawing the rectangles in the
+ *          order they were recorded. Each list entry takes 8 bytes of RAM, and
+ *          each visible part 5 bytes. If a flush would need more than
+ *          DRAWLIST_MAX_FRAGMENTS parts, the list is sent without the third
+ *          step instead
+ * @{
+ */
+
+#ifndef GLCD_DRAWLIST_H
+#define GLCD_DRAWLIST_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Macros ***********************************/
+/** @brief Rectangles held by the list before it's flushed automatically */
+#define DRAWLIST_MAX_ITEMS 32
+
+/** @brief Visible parts of rectangles a flush can track (max: 255) */
+#define DRAWLIST_MAX_FRAGMENTS 64
+
+/********************************** Types ************************************/
+/** @brief Bus cost of what was recorded versus what was sent */
+typedef struct{
+    unsigned short itemsRecorded; /**< Rectangles recorded */
+    unsigned short itemsSent;     /**< Rectangles sent after optimization */
+    unsigned long bytesRecorded;  /**< Bytes if sent as recorded */
+    unsigned long bytesSent;      /**< Bytes actually sent */
+    unsigned short fallbacks;     /**< Flushes with too many visible parts */
+}drawlist_stats_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Records a solid rectangle (see glcdDrawRectangle). If the list is
+ *        full, it is flushed first
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param color Color of the rectangle
+ */
+void glcdDrawListRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+);
+
+/** @brief Optimizes the recorded rectangles, sends them, and empties the list */
+void glcdDrawListFlush(void);
+
+/** @brief Empties the list without sending anything */
+void glcdDrawListClear(void);
+
+/**
+ * @brief Gets the bus cost of everything flushed since the last reset
+ * @param stats Where to put the statistics
+ */
+void glcdDrawListGetStats(drawlist_stats_t* stats);
+
+/** @brief Resets the statistics */
+void glcdDrawListResetStats(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_DRAWLIST_H */
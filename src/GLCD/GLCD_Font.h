@@ -0,0 +1,85 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Font
+ * @brief 5 x 7 pixel text rendering for the GLCD
+ * @{
+ */
+
+#ifndef GLCD_FONT_H
+#define GLCD_FONT_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Macros ***********************************/
+#define FONT_GLYPH_WIDTH  5 /**< Columns of pixels in a glyph           */
+#define FONT_GLYPH_HEIGHT 7 /**< Rows of pixels in a glyph              */
+#define FONT_CHAR_WIDTH   6 /**< Glyph plus one column of spacing       */
+#define FONT_CHAR_HEIGHT  8 /**< Glyph plus one row of spacing          */
+#define FONT_FIRST_CHAR   ' ' /**< First printable character in the font */
+#define FONT_LAST_CHAR    '~' /**< Last printable character in the font  */
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Looks up the glyph for a character
+ * @details Each glyph is FONT_GLYPH_WIDTH bytes, one per column from left to
+ *          right. The LSb of each byte is the top row. Characters outside of
+ *          the font are given the glyph for '?'
+ * @param c The character
+ * @return Pointer to the glyph's columns
+ */
+const unsigned char* fontGetGlyph(char c);
+
+/**
+ * @brief Sends the pixels of a character cell to the open drawing window
+ * @details Writes FONT_CHAR_WIDTH columns of FONT_CHAR_HEIGHT pixels each,
+ *          which matches the order the controller fills a window that is
+ *          FONT_CHAR_HEIGHT pixels tall. Used to build strings of characters
+ *          inside a single window
+ * @param c The character
+ * @param fg Color of the character
+ * @param bg Color of the rest of the cell
+ */
+void fontWriteChar(char c, unsigned long fg, unsigned long bg);
+
+/**
+ * @brief Draws a character cell, FONT_CHAR_WIDTH by FONT_CHAR_HEIGHT pixels
+ * @param x x-position of the cell's first column
+ * @param y y-position of the cell's first row
+ * @param c The character
+ * @param fg Color of the character
+ * @param bg Color of the rest of the cell
+ */
+void glcdDrawChar(
+    unsigned char x,
+    unsigned char y,
+    char c,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @brief Draws a string on a single line, using one drawing window for all
+ *        its characters. The string is cut off at the edge of the display
+ * @param x x-position of the first character cell
+ * @param y y-position of the first character cell
+ * @param str The null-terminated string
+ * @param fg Color of the characters
+ * @param bg Color of the rest of the cells
+ */
+void glcdDrawString(
+    unsigned char x,
+    unsigned char y,
+    const char* str,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_FONT_H */
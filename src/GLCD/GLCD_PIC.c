@@ -8,9 +8,41 @@
  */
 
 /********************************* Includes **********************************/
+#include <string.h>
 #include "GLCD_PIC.h"
+#include "GLCD_Profiler.h"
+#include "GLCD_Trace.h"
 #include "../SPI/SPI_PIC.h"
 
+/********************************** Macros ***********************************/
+#if defined(GLCD_PERF_COUNTERS)
+/** @brief Adds to one of the performance counters */
+#define PERF_ADD(counter, n) (perf.counter += (n))
+
+/** @brief Counts pixels written, also towards the current window */
+#define PERF_PIXELS(n) (perf.pixels += (n), windowPixels += (n))
+
+/** @brief Counts a selection of the display, if it's not selected already */
+#define PERF_SELECT() do{ if(LAT_CS_GLCD & csMask){ perf.csToggles++; } }while(0)
+
+/** @brief Forgets the last window, e.g. when the addresses are reinterpreted */
+#define PERF_FORGET_WINDOW() (lastWindowValid = 0)
+#else
+#define PERF_ADD(counter, n)
+#define PERF_PIXELS(n)
+#define PERF_SELECT()
+#define PERF_FORGET_WINDOW()
+#endif
+
+/** @brief Selects the display(s) */
+#define GLCD_SELECT() (LAT_CS_GLCD &= ~csMask)
+
+/** @brief Deselects the display(s) */
+#define GLCD_DESELECT() (LAT_CS_GLCD |= csMask)
+
+/** @brief Accounts for pixel data sent without going through glcdTransfer */
+#define DATA_SENT(n) do{ PERF_ADD(dataBytes, n); TRACE_DATA(n); }while(0)
+
 /******************************** Constants **********************************/
 const unsigned char GLCD_ADDRESSABLE_SIZE_HORZ = 128;
 const unsigned char GLCD_ADDRESSABLE_SIZE_VERT = 160;
@@ -32,7 +64,6 @@ const unsigned long VIOLET = 0x9400D3;
 // Display command codes (write only, since we don't have hardware to read).
 // These are static which makes them only visible to this compilation unit,
 // effectively hiding them from the rest of the application
-static const unsigned char INST_NOP = 0x00;      /**< Empty processor cycle */
 static const unsigned char INST_SWRESET = 0x01;  /**< All registers to default state */
 static const unsigned char INST_SLPIN = 0x10;    /**< Enter sleep mode */
 static const unsigned char INST_SLPOUT = 0x11;   /**< Exit sleep mode */
@@ -47,9 +78,11 @@ static const unsigned char INST_CASET = 0x2A;    /**< Set column address */
 static const unsigned char INST_RASET = 0x2B;    /**< Set row address */
 static const unsigned char INST_RAMWR = 0x2C;    /**< Enables RAM writes */
 static const unsigned char INST_PTLAR = 0x30;    /**< Partial start/end address */
+static const unsigned char INST_SCRLAR = 0x33;   /**< Scroll area definition */
 static const unsigned char INST_TEOFF = 0x34;    /**< Tearing effect off */
 static const unsigned char INST_TEON = 0x35;     /**< Tearing effect on */
 static const unsigned char INST_MADCTL  = 0x36;  /**< Memory data access control */
+static const unsigned char INST_VSCSAD = 0x37;   /**< Vertical scroll start address */
 static const unsigned char INST_IDMOFF = 0x38;   /**< Idle mode off */
 static const unsigned char INST_IDMON = 0x39;    /**< Idle mode on */
 static const unsigned char INST_COLMOD = 0x3A;   /**< Interface pixel format */
@@ -63,7 +96,59 @@ static const unsigned char INST_PWCTR3 = 0xC2;   /**< Power control3 */
 static const unsigned char INST_PWCTR4 = 0xC3;   /**< Power control4 */
 static const unsigned char INST_PWCTR5 = 0xC4;   /**< Power control5 */
 static const unsigned char INST_VMCTR1 = 0xC5;   /**< VCOM control 1 */
-static const unsigned char INST_VMOFCTR2 = 0xC7; /**< VCOM control 2 */
+
+// Also in the instruction set, but never sent by the driver (left out so that
+// builds with unused variable warnings stay clean): NOP (0x00, empty
+// processor cycle) and VMOFCTR2 (0xC7, VCOM control 2)
+
+// PCB version of the display used until glcdSelectPanel is called
+#if defined(V1_1)
+    #define DEFAULT_VERSION GLCD_PANEL_V1_1
+#elif defined(V2_1)
+    #define DEFAULT_VERSION GLCD_PANEL_V2_1
+#else
+    #error "Must define either V1_1 or V2_1 in the GLCD's header file"
+#endif
+
+// Geometry of the selected display's RAM (see GEOMETRIES)
+#define PANEL_MEM_COLS (geometry->memCols)
+#define PANEL_MEM_ROWS (geometry->memRows)
+#define PANEL_COL_ORIGIN (geometry->colOrigin)
+#define PANEL_ROW_ORIGIN (geometry->rowOrigin)
+
+// Frequency of the controller's internal oscillator, from which the line and
+// frame periods are derived (see FRMCTR1 in the datasheet)
+static const unsigned long PANEL_FOSC = 850000;
+
+// Parameters for TEON
+static const unsigned char TE_MODE_VBLANK = 0x00; /**< TE pulses during V-blanking only */
+
+// Registers and modes kept in the shadow. The mode bits are used both in
+// shadow.valid (the setting is known) and shadow.modes (the mode is on)
+static const unsigned short SHADOW_SLEEP_OUT = 0x0001;  /**< SLPOUT/SLPIN */
+static const unsigned short SHADOW_PARTIAL = 0x0002;    /**< PTLON/NORON */
+static const unsigned short SHADOW_INVERT = 0x0004;     /**< INVON/INVOFF */
+static const unsigned short SHADOW_DISPLAY_ON = 0x0008; /**< DISPON/DISPOFF */
+static const unsigned short SHADOW_IDLE = 0x0010;       /**< IDMON/IDMOFF */
+static const unsigned short SHADOW_TE = 0x0020;         /**< TEON/TEOFF */
+static const unsigned short SHADOW_MADCTL = 0x0040;
+static const unsigned short SHADOW_COLMOD = 0x0080;
+static const unsigned short SHADOW_PTLAR = 0x0100;
+static const unsigned short SHADOW_FRMCTR2 = 0x0200;
+static const unsigned short SHADOW_FRMCTR1 = 0x0400;
+static const unsigned short SHADOW_FRMCTR3 = 0x0800;
+static const unsigned short SHADOW_PWCTR = 0x1000;  /**< PWCTR1-5 of profile */
+static const unsigned short SHADOW_SCRLAR = 0x2000;
+static const unsigned short SHADOW_VSCSAD = 0x4000; /**< Scrolling, from ssa */
+
+// Waits after SWRESET before SLPOUT may be sent, and after SLPOUT before the
+// next command, from the datasheet. initGLCD waits longer, to be safe
+static const unsigned char RECOVER_SWRESET_MS = 120;
+static const unsigned char RECOVER_SLPOUT_MS = 5;
+
+// Step used for busy-waiting on the scan position. Waits are rounded up to a
+// multiple of this, which errs on the side of starting later
+static const unsigned char SCAN_WAIT_STEP_US = 10;
 
 /********************************** Types ************************************/
 /**
@@ -90,67 +175,801 @@ typedef union{
     unsigned char reg; /**< Way of accessing the above 8 bits, as a byte */
 }MADCTLbits_t;
 
+/**
+ * @brief Frame rate and power control register values that make up a profile
+ * @details Each frame rate control register takes the line period (RTN) and
+ *          the front and back porches (FP, BP) for its mode. The frame rate is
+ *          fosc / ((RTN x 2 + 40) x (LINE + FP + BP + 2))
+ */
+typedef struct{
+    unsigned char frmctr1[3]; /**< Normal mode frame rate */
+    unsigned char frmctr2[3]; /**< Idle mode frame rate */
+    unsigned char frmctr3[3]; /**< Partial mode frame rate */
+    unsigned char pwctr1[3];  /**< GVDD/AVDD, GVCL, and mode */
+    unsigned char pwctr2[1];  /**< Power supply level */
+    unsigned char pwctr3[2];  /**< Op amp current and booster clock, normal mode */
+    unsigned char pwctr4[2];  /**< Op amp current and booster clock, idle mode */
+    unsigned char pwctr5[2];  /**< Op amp current and booster clock, partial mode */
+}glcd_profile_t;
+
+// Profiles selectable with glcdSetProfile. High refresh is what initGLCD has
+// always used: a fast normal mode frame rate, with the power settings from
+// Sumotoy. Balanced uses the datasheet's default frame rates. Low power uses
+// the longest line period and porches, and the smallest op amp currents
+static const glcd_profile_t PROFILES[] = {
+    // GLCD_PROFILE_HIGH_REFRESH
+    {
+        {0x00, 0x06, 0x03},
+        {0x01, 0x2C, 0x2D},
+        {0x01, 0x2C, 0x2D},
+        {0xA2, 0x02, 0x84}, // GVDD 3.9 V, AVDD 5 V, GVCL -4.6 V, AUTO
+        {0xC5},             // Datasheet default (pg. 132)
+        {0x0A, 0x00},       // Datasheet default (pg. 134)
+        {0x8A, 0x2A},       // Booster clock divided by 2 (pg. 136)
+        {0x8A, 0x2A}        // Booster clock divided by 2 (pg. 138)
+    },
+    // GLCD_PROFILE_BALANCED
+    {
+        {0x01, 0x2C, 0x2D},
+        {0x01, 0x2C, 0x2D},
+        {0x01, 0x2C, 0x2D},
+        {0xA2, 0x02, 0x84},
+        {0xC5},
+        {0x0A, 0x00},
+        {0x8A, 0x2A},
+        {0x8A, 0x2A}
+    },
+    // GLCD_PROFILE_LOW_POWER
+    {
+        {0x0F, 0x3F, 0x3F},
+        {0x0F, 0x3F, 0x3F},
+        {0x0F, 0x3F, 0x3F},
+        {0xA2, 0x02, 0x84},
+        {0xC5},
+        {0x09, 0x00},       // Small op amp current
+        {0x89, 0x2A},       // Small op amp current
+        {0x89, 0x2A}        // Small op amp current
+    }
+};
+
+/**
+ * @brief Geometry of the controller's display data RAM, and the location of
+ *        the 128 x 128 panel within it (in unrotated column/row coordinates).
+ *        These are what the rotation offsets are derived from
+ */
+typedef struct{
+    unsigned char memCols;   /**< Columns in display RAM */
+    unsigned char memRows;   /**< Rows in display RAM */
+    unsigned char colOrigin; /**< First column on the panel */
+    unsigned char rowOrigin; /**< First row on the panel */
+}glcd_geometry_t;
+
+// Geometry of each PCB version, in the order of glcd_panel_version_e
+static const glcd_geometry_t GEOMETRIES[] = {
+    {132, 162, 2, 1}, // GLCD_PANEL_V1_1
+    {128, 160, 0, 0}  // GLCD_PANEL_V2_1
+};
+
 /***************************** Private Variables *****************************/
 static MADCTLbits_t MADCTLbits;
 
+// The display(s) selected: chip select bits, RAM geometry, and handles to
+// save the driver's state to when another display is selected
+static unsigned char csMask = CS_GLCD_MASK;
+static const glcd_geometry_t* geometry = &GEOMETRIES[DEFAULT_VERSION];
+static glcd_panel_t* const* selected = 0;
+static unsigned char numSelected = 0;
+static glcd_panel_t* single;
+
+// What the driver last wrote to the controller's settings, so that writes
+// that wouldn't change anything can be skipped. Nothing is known until it's
+// been written, and everything is forgotten on a software reset
+static glcd_state_t shadow;
+
+// Offsets added to x- and y-coordinates so that they land on the panel, given
+// the current MADCTL settings
+static unsigned char xOffset;
+static unsigned char yOffset;
+
+// Partial display area, in panel rows (0 = first row scanned by the panel)
+static unsigned char partialStart = 0;
+static unsigned char partialEnd = 127;
+static unsigned char partialModeOn = 0; /**< 1 while PTLON is in effect */
+
+// Normal mode frame rate parameters (FRMCTR1), used to predict the scan timing
+static unsigned char frameRTNA = 0x00;
+static unsigned char frameFPA = 0x06;
+static unsigned char frameBPA = 0x03;
+
+// Idle mode frame rate parameters (FRMCTR2)
+static unsigned char idleRTNB = 0x01;
+static unsigned char idleFPB = 0x2C;
+static unsigned char idleBPB = 0x2D;
+
+static unsigned char inTransaction = 0; /**< 1 while CS is held low */
+
+static unsigned char colmodBpp = 18; /**< Interface pixel format, in bpp */
+
+// At 12 bpp, two pixels share three bytes. These hold the first pixel of a
+// pair until the second one is written
+static unsigned char pixelPending = 0;
+static unsigned char pendingData[2];
+static unsigned char normalBpp = 18; /**< Format to restore after idle mode */
+
+#if defined(GLCD_PERF_COUNTERS)
+static glcd_perf_t perf;
+
+// The last window set, and the pixels written to it since. If the same window
+// is set again after a whole number of passes over it, the controller's
+// address counters were already at its start
+static unsigned char lastXS, lastXE, lastYS, lastYE;
+static unsigned char lastWindowValid = 0;
+static unsigned long windowPixels = 0;
+#endif
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Recomputes the x- and y-offsets from the MADCTL settings
+ * @details The panel only covers part of the display RAM, so depending on
+ *          which axes are mirrored, the first visible column and row are not
+ *          necessarily at address 0. Note that x-coordinates are sent with
+ *          RASET and y-coordinates with CASET, so when MV = 1 (row/column
+ *          exchange), x runs along the panel's columns and y along its rows
+ */
+static void glcdUpdateOffsets(void){
+    unsigned char colOffset = (MADCTLbits.MX == 1) ?
+        PANEL_MEM_COLS - GLCD_SIZE_HORZ - PANEL_COL_ORIGIN : PANEL_COL_ORIGIN;
+    unsigned char rowOffset = (MADCTLbits.MY == 1) ?
+        PANEL_MEM_ROWS - GLCD_SIZE_VERT - PANEL_ROW_ORIGIN : PANEL_ROW_ORIGIN;
+    
+    if(MADCTLbits.MV == 1){
+        xOffset = colOffset;
+        yOffset = rowOffset;
+    }
+    else{
+        xOffset = rowOffset;
+        yOffset = colOffset;
+    }
+}
+
+/**
+ * @brief Clips a window to the rows of the partial display area
+ * @details Panel rows run along y when MV = 1 and along x otherwise, and are
+ *          counted from the opposite edge when MY = 1. Wrap-around areas
+ *          (start row after end row) are not clipped
+ * @param XS Pointer to the window's start position on the x-axis
+ * @param XE Pointer to the window's end position on the x-axis (exclusive)
+ * @param YS Pointer to the window's start position on the y-axis
+ * @param YE Pointer to the window's end position on the y-axis (exclusive)
+ * @return 0 if nothing of the window is left to draw, otherwise 1
+ */
+static unsigned char glcdClipToPartialArea(
+    unsigned char* XS,
+    unsigned char* XE,
+    unsigned char* YS,
+    unsigned char* YE
+)
+{
+    if(partialStart > partialEnd){
+        return 1;
+    }
+    
+    // Express the partial area along the axis that runs along the panel rows
+    unsigned char first, last;
+    if(MADCTLbits.MY == 1){
+        first = (GLCD_SIZE_VERT - 1) - partialEnd;
+        last = (GLCD_SIZE_VERT - 1) - partialStart;
+    }
+    else{
+        first = partialStart;
+        last = partialEnd;
+    }
+    
+    unsigned char* start = (MADCTLbits.MV == 1) ? YS : XS;
+    unsigned char* end = (MADCTLbits.MV == 1) ? YE : XE;
+    if(*start < first){
+        *start = first;
+    }
+    if(*end > last + 1){
+        *end = last + 1;
+    }
+    
+    return (*start < *end) ? 1 : 0;
+}
+
+/**
+ * @brief Sends a command followed by its parameters
+ * @param inst The command
+ * @param params The parameters
+ * @param numParams The number of parameters
+ */
+static void glcdWriteCommand(
+    unsigned char inst,
+    const unsigned char* params,
+    unsigned char numParams
+)
+{
+    glcdTransfer(inst, CMD);
+    for(unsigned char i = 0; i < numParams; i++){
+        glcdTransfer(params[i], MEMWRITE);
+    }
+}
+
+/**
+ * @brief Turns one of the on/off modes on or off, unless the shadow shows it
+ *        is already
+ * @param mode The mode's SHADOW_* bit
+ * @param on 1 to turn it on, 0 to turn it off
+ * @param inst The command that does so
+ * @return 1 if the command was sent, 0 if it was skipped
+ */
+static unsigned char glcdWriteMode(
+    unsigned char mode,
+    unsigned char on,
+    unsigned char inst
+)
+{
+    if((shadow.valid & mode) && (((shadow.modes & mode) != 0) == on)){
+        PERF_ADD(skippedCommands, 1);
+        return 0;
+    }
+    glcdTransfer(inst, CMD);
+    shadow.valid |= mode;
+    if(on){
+        shadow.modes |= mode;
+    }
+    else{
+        shadow.modes &= ~mode;
+    }
+    return 1;
+}
+
+/**
+ * @brief Sets one of the frame rate registers (FRMCTR1 to 3), unless the
+ *        shadow shows it is set already
+ * @param inst The register's command
+ * @param reg The register's SHADOW_* bit
+ * @param known The register's parameters in the shadow
+ * @param params RTN, FP and BP
+ */
+static void glcdWriteFrameRate(
+    unsigned char inst,
+    unsigned short reg,
+    unsigned char* known,
+    const unsigned char* params
+)
+{
+    if((shadow.valid & reg) && (memcmp(known, params, 3) == 0)){
+        PERF_ADD(skippedCommands, 1);
+        return;
+    }
+    glcdWriteCommand(inst, params, 3);
+    memcpy(known, params, 3);
+    shadow.valid |= reg;
+}
+
+/**
+ * @brief Sets the power control registers (PWCTR1 to 5) for a profile, unless
+ *        the shadow shows they are set already. They are only ever set from a
+ *        profile, so the shadow just remembers which one
+ * @param profile The profile
+ */
+static void glcdWritePowerControl(glcd_profile_e profile){
+    if((shadow.valid & SHADOW_PWCTR) && (shadow.profile == profile)){
+        PERF_ADD(skippedCommands, 5);
+        return;
+    }
+    const glcd_profile_t* p = &PROFILES[profile];
+    glcdWriteCommand(INST_PWCTR1, p->pwctr1, 3);
+    glcdWriteCommand(INST_PWCTR2, p->pwctr2, 1);
+    glcdWriteCommand(INST_PWCTR3, p->pwctr3, 2);
+    glcdWriteCommand(INST_PWCTR4, p->pwctr4, 2);
+    glcdWriteCommand(INST_PWCTR5, p->pwctr5, 2);
+    shadow.profile = profile;
+    shadow.valid |= SHADOW_PWCTR;
+}
+
+/**
+ * @brief Sets the whole panel as the vertical scroll area (SCRLAR), unless
+ *        the shadow shows it is set already. It only depends on the panel, so
+ *        the shadow just remembers that it's been set
+ */
+static void glcdWriteScrollArea(void){
+    if(shadow.valid & SHADOW_SCRLAR){
+        PERF_ADD(skippedCommands, 1);
+        return;
+    }
+    
+    // The scroll area covers the panel, and the display RAM rows on either
+    // side of it are the top and bottom fixed areas
+    unsigned char TFA = PANEL_ROW_ORIGIN;
+    unsigned char VSA = GLCD_SIZE_VERT;
+    unsigned char BFA = PANEL_MEM_ROWS - GLCD_SIZE_VERT - PANEL_ROW_ORIGIN;
+    
+    glcdTransfer(INST_SCRLAR, CMD);
+    glcdTransfer(0x00, MEMWRITE); // TFA[15:8]
+    glcdTransfer(TFA, MEMWRITE); // TFA[7:0]
+    glcdTransfer(0x00, MEMWRITE); // VSA[15:8]
+    glcdTransfer(VSA, MEMWRITE); // VSA[7:0]
+    glcdTransfer(0x00, MEMWRITE); // BFA[15:8]
+    glcdTransfer(BFA, MEMWRITE); // BFA[7:0]
+    shadow.valid |= SHADOW_SCRLAR;
+}
+
+/**
+ * @brief Starts scrolling from a display RAM row (VSCSAD), unless the shadow
+ *        shows it already is
+ * @param SSA The row
+ */
+static void glcdWriteScrollStart(unsigned char SSA){
+    if((shadow.valid & SHADOW_VSCSAD) && (shadow.ssa == SSA)){
+        PERF_ADD(skippedCommands, 1);
+        return;
+    }
+    
+    glcdTransfer(INST_VSCSAD, CMD);
+    glcdTransfer(0x00, MEMWRITE); // SSA[15:8]
+    glcdTransfer(SSA, MEMWRITE); // SSA[7:0]
+    shadow.ssa = SSA;
+    shadow.valid |= SHADOW_VSCSAD;
+    
+    // Scrolling replaces normal or partial mode, so whichever of NORON and
+    // PTLON comes next has to be sent
+    shadow.valid &= ~SHADOW_PARTIAL;
+}
+
+/**
+ * @brief Sends the panel settings that initGLCD sets once and nothing else
+ *        changes: display inversion control, VCOM voltage and gamma curve
+ */
+static void glcdSendPanelSetup(void){
+    static const unsigned char INVCTR_NO_INVERSION = 0x00;
+    static const unsigned char VMCTR1_VCOM = 0x3C; // Important for power circuits
+    static const unsigned char GAMSET_2_2 = 0x01; // Gamma curve 2.2 (default)
+    
+    glcdWriteCommand(INST_INVCTR, &INVCTR_NO_INVERSION, 1);
+    glcdWriteCommand(INST_VMCTR1, &VMCTR1_VCOM, 1);
+    glcdWriteCommand(INST_GAMSET, &GAMSET_2_2, 1);
+}
+
+/**
+ * @brief Sends the settings in a saved state that the shadow doesn't already
+ *        match, except for sleep mode, and takes on the state's orientation,
+ *        pixel format and partial area. The display is turned on last
+ * @param known The state
+ */
+static void glcdReplayState(const glcd_state_t* known){
+    if(known->valid & SHADOW_COLMOD){
+        glcdSetCOLMOD((known->colmod == 0x03) ? 12 :
+                      (known->colmod == 0x05) ? 16 : 18);
+    }
+    if(known->valid & SHADOW_MADCTL){
+        MADCTLbits.reg = known->madctl;
+        glcd_setmadctl();
+    }
+    if(known->valid & SHADOW_FRMCTR1){
+        glcdWriteFrameRate(INST_FRMCTR1, SHADOW_FRMCTR1, shadow.frmctr1,
+                           known->frmctr1);
+    }
+    if(known->valid & SHADOW_FRMCTR2){
+        glcdWriteFrameRate(INST_FRMCTR2, SHADOW_FRMCTR2, shadow.frmctr2,
+                           known->frmctr2);
+    }
+    if(known->valid & SHADOW_FRMCTR3){
+        glcdWriteFrameRate(INST_FRMCTR3, SHADOW_FRMCTR3, shadow.frmctr3,
+                           known->frmctr3);
+    }
+    if(known->valid & SHADOW_PWCTR){
+        glcdWritePowerControl(known->profile);
+    }
+    if(known->valid & SHADOW_SCRLAR){
+        glcdWriteScrollArea();
+    }
+    if(known->valid & SHADOW_PTLAR){
+        glcdSetPartialArea(known->ptlar[0] - PANEL_ROW_ORIGIN,
+                           known->ptlar[1] - PANEL_ROW_ORIGIN);
+    }
+    
+    // The rest are on/off modes
+    const unsigned char MODES[][3] = {
+        {SHADOW_PARTIAL, INST_PTLON, INST_NORON},
+        {SHADOW_INVERT, INST_INVON, INST_INVOFF},
+        {SHADOW_IDLE, INST_IDMON, INST_IDMOFF},
+        {SHADOW_TE, INST_TEON, INST_TEOFF},
+        {SHADOW_DISPLAY_ON, INST_DISPON, INST_DISPOFF}
+    };
+    for(unsigned char i = 0; i < sizeof(MODES) / sizeof(MODES[0]); i++){
+        unsigned char mode = MODES[i][0];
+        if(known->valid & mode){
+            unsigned char on = (known->modes & mode) != 0;
+            if(glcdWriteMode(mode, on, on ? MODES[i][1] : MODES[i][2]) &&
+               (mode == SHADOW_TE) && on){
+                glcdTransfer(TE_MODE_VBLANK, MEMWRITE);
+            }
+        }
+    }
+    
+    // Scrolling last, since NORON would end it
+    if(known->valid & SHADOW_VSCSAD){
+        glcdWriteScrollStart(known->ssa);
+    }
+    partialModeOn = (shadow.modes & SHADOW_PARTIAL) != 0;
+    shadow.profile = known->profile;
+}
+
+/**
+ * @brief Saves the driver's state for the selected display in its handle
+ * @param panel The handle
+ */
+static void glcdSavePanel(glcd_panel_t* panel){
+    panel->state = shadow;
+    panel->madctl = MADCTLbits.reg;
+    panel->bpp = colmodBpp;
+    panel->normalBpp = normalBpp;
+    panel->partialStart = partialStart;
+    panel->partialEnd = partialEnd;
+    panel->partialModeOn = partialModeOn;
+    panel->frmctr1[0] = frameRTNA;
+    panel->frmctr1[1] = frameFPA;
+    panel->frmctr1[2] = frameBPA;
+    panel->idle[0] = idleRTNB;
+    panel->idle[1] = idleFPB;
+    panel->idle[2] = idleBPB;
+}
+
+/**
+ * @brief Loads the driver's state for a display from its handle
+ * @param panel The handle
+ */
+static void glcdLoadPanel(const glcd_panel_t* panel){
+    shadow = panel->state;
+    MADCTLbits.reg = panel->madctl;
+    colmodBpp = panel->bpp;
+    normalBpp = panel->normalBpp;
+    partialStart = panel->partialStart;
+    partialEnd = panel->partialEnd;
+    partialModeOn = panel->partialModeOn;
+    frameRTNA = panel->frmctr1[0];
+    frameFPA = panel->frmctr1[1];
+    frameBPA = panel->frmctr1[2];
+    idleRTNB = panel->idle[0];
+    idleFPB = panel->idle[1];
+    idleBPB = panel->idle[2];
+    geometry = &GEOMETRIES[panel->version];
+    glcdUpdateOffsets();
+    pixelPending = 0;
+    PERF_FORGET_WINDOW();
+}
+
+/**
+ * @brief Deselects the display(s) selected, and saves the driver's state in
+ *        each of their handles
+ */
+static void glcdSaveSelected(void){
+    GLCD_DESELECT();
+    for(unsigned char i = 0; i < numSelected; i++){
+        glcdSavePanel(selected[i]);
+    }
+    numSelected = 0;
+}
+
+/**
+ * @brief Forgets the settings in the shadow that another display's shadow
+ *        doesn't agree with, so that they're sent when broadcasting
+ * @param other The other display's shadow
+ */
+static void glcdMergeShadow(const glcd_state_t* other){
+    shadow.valid &= other->valid;
+    shadow.valid &= ~(unsigned short)(shadow.modes ^ other->modes);
+    if(shadow.madctl != other->madctl){
+        shadow.valid &= ~SHADOW_MADCTL;
+    }
+    if(shadow.colmod != other->colmod){
+        shadow.valid &= ~SHADOW_COLMOD;
+    }
+    if(memcmp(shadow.ptlar, other->ptlar, sizeof(shadow.ptlar)) != 0){
+        shadow.valid &= ~SHADOW_PTLAR;
+    }
+    if(memcmp(shadow.frmctr2, other->frmctr2, sizeof(shadow.frmctr2)) != 0){
+        shadow.valid &= ~SHADOW_FRMCTR2;
+    }
+    if(memcmp(shadow.frmctr1, other->frmctr1, sizeof(shadow.frmctr1)) != 0){
+        shadow.valid &= ~SHADOW_FRMCTR1;
+    }
+    if(memcmp(shadow.frmctr3, other->frmctr3, sizeof(shadow.frmctr3)) != 0){
+        shadow.valid &= ~SHADOW_FRMCTR3;
+    }
+    if(shadow.profile != other->profile){
+        shadow.valid &= ~SHADOW_PWCTR;
+    }
+    if(shadow.ssa != other->ssa){
+        shadow.valid &= ~SHADOW_VSCSAD;
+    }
+}
+
+/**
+ * @brief Computes the frame rate for a set of frame rate control parameters
+ * @param params RTN, FP, and BP (the parameters of FRMCTR1, 2, or 3)
+ * @return Frame rate, in Hz (rounded to nearest)
+ */
+static unsigned short glcdComputeFrameRate(const unsigned char* params){
+    unsigned long clocksPerFrame = (params[0] * 2UL + 40) *
+        (PANEL_MEM_ROWS + params[1] + params[2] + 2);
+    return (unsigned short)((PANEL_FOSC + clocksPerFrame / 2) / clocksPerFrame);
+}
+
+/**
+ * @brief Computes the time taken by the panel to scan one line in normal mode
+ * @return Line period, in microseconds
+ */
+static unsigned short glcdGetLinePeriod(void){
+    return (unsigned short)(((frameRTNA * 2UL + 40) * 1000000UL) / PANEL_FOSC);
+}
+
+/**
+ * @brief Computes the number of lines in a frame, including the porches
+ * @return Lines per frame
+ */
+static unsigned short glcdGetFrameLines(void){
+    return PANEL_MEM_ROWS + frameFPA + frameBPA + 2;
+}
+
+/**
+ * @brief Computes the time taken to send bytes at the current SPI clock,
+ *        including the software overhead around each one
+ * @param bytes Number of bytes
+ * @return Time, in microseconds (rounded up)
+ */
+static unsigned long glcdGetBusTime(unsigned long bytes){
+    unsigned long cycles = bytes * spi_byte_cycles(spiGetDivider());
+    return (cycles * 4 + (_XTAL_FREQ / 1000000UL) - 1) /
+           (_XTAL_FREQ / 1000000UL);
+}
+
+/**
+ * @brief Busy-waits for approximately the time specified
+ * @param us Time to wait, in microseconds
+ */
+static void glcdWaitUs(unsigned long us){
+    while(us > 0){
+        __delay_us(SCAN_WAIT_STEP_US);
+        us = (us > SCAN_WAIT_STEP_US) ? us - SCAN_WAIT_STEP_US : 0;
+    }
+}
+
+/**
+ * @brief Converts a coordinate along the panel-row axis into a panel row
+ * @param u The x-coordinate if MV = 0, or the y-coordinate if MV = 1
+ * @return The panel row (0 is scanned first)
+ */
+static unsigned char glcdToPanelRow(unsigned char u){
+    return (MADCTLbits.MY == 1) ? (GLCD_SIZE_VERT - 1) - u : u;
+}
+
+/**
+ * @brief Sets the drawing window and issues the RAM write command
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ */
+static void glcdSendWindow(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+)
+{
+    unsigned char window[GLCD_WINDOW_SETUP_BYTES];
+    glcdEncodeWindow(XS, XE, YS, YE, window);
+    
+    for(unsigned char i = 0; i < GLCD_WINDOW_SETUP_BYTES; i++){
+        glcdTransfer(window[i], GLCD_WINDOW_IS_CMD(i) ? CMD : MEMWRITE);
+    }
+    pixelPending = 0;
+
+#if defined(GLCD_PERF_COUNTERS)
+    perf.windowSetups++;
+    unsigned short area = (unsigned short)(XE - XS) * (YE - YS);
+    if(lastWindowValid && (XS == lastXS) && (XE == lastXE) &&
+       (YS == lastYS) && (YE == lastYE) &&
+       ((area == 0) || (windowPixels % area == 0))){
+        perf.redundantWindows++;
+    }
+    lastXS = XS;
+    lastXE = XE;
+    lastYS = YS;
+    lastYE = YE;
+    lastWindowValid = 1;
+    windowPixels = 0;
+#endif
+}
+
+/**
+ * @brief Finds the visible panel pixel that a window address maps to
+ * @details Addresses sent with RASET (x) map to panel rows when MV = 0 and
+ *          to panel columns when MV = 1, and addresses sent with CASET (y) to
+ *          the other. MX and MY then mirror the panel columns and rows.
+ *          Points outside the display are extended linearly
+ * @param madctl The MADCTL setting
+ * @param x x-position
+ * @param y y-position
+ * @param col Panel column
+ * @param row Panel row
+ */
+static void glcdMapToPanel(
+    unsigned char madctl,
+    short x,
+    short y,
+    short* col,
+    short* row
+)
+{
+    MADCTLbits_t m;
+    m.reg = madctl;
+    short a = (m.MV == 1) ? x : y;
+    short b = (m.MV == 1) ? y : x;
+    *col = (m.MX == 1) ? (GLCD_SIZE_HORZ - 1) - a : a;
+    *row = (m.MY == 1) ? (GLCD_SIZE_VERT - 1) - b : b;
+}
+
+/**
+ * @brief Finds the window address that maps to a visible panel pixel. The
+ *        inverse of glcdMapToPanel
+ * @param madctl The MADCTL setting
+ * @param col Panel column
+ * @param row Panel row
+ * @param x x-position
+ * @param y y-position
+ */
+static void glcdMapFromPanel(
+    unsigned char madctl,
+    short col,
+    short row,
+    short* x,
+    short* y
+)
+{
+    MADCTLbits_t m;
+    m.reg = madctl;
+    short a = (m.MX == 1) ? (GLCD_SIZE_HORZ - 1) - col : col;
+    short b = (m.MY == 1) ? (GLCD_SIZE_VERT - 1) - row : row;
+    *x = (m.MV == 1) ? a : b;
+    *y = (m.MV == 1) ? b : a;
+}
+
+/**
+ * @brief Finds where a pixel of an image ends up on the panel when placed
+ *        by glcdBlit in the current orientation
+ * @param x x-position of the placed image
+ * @param y y-position of the placed image
+ * @param width Width of the image as stored
+ * @param height Height of the image as stored
+ * @param transform How the image is placed
+ * @param u Column within the stored image
+ * @param v Row within the stored image
+ * @param col Panel column
+ * @param row Panel row
+ */
+static void glcdMapImagePixel(
+    unsigned char x,
+    unsigned char y,
+    unsigned char width,
+    unsigned char height,
+    glcd_blit_transform_e transform,
+    short u,
+    short v,
+    short* col,
+    short* row
+)
+{
+    if(transform & BLIT_SWAP_XY){
+        short t = u;
+        u = v;
+        v = t;
+        t = width;
+        width = height;
+        height = t;
+    }
+    if(transform & BLIT_MIRROR_X){
+        u = (width - 1) - u;
+    }
+    if(transform & BLIT_MIRROR_Y){
+        v = (height - 1) - v;
+    }
+    glcdMapToPanel(MADCTLbits.reg, x + u, y + v, col, row);
+}
+
 /***************************** Public Functions ******************************/
 void glcdTransfer(unsigned char byte, glcd_transfer_mode_e cmd){
     RS_GLCD = (cmd == CMD) ? 0 : 1; // RS low for command, and high for data
+    PERF_ADD(commandBytes, cmd == CMD);
+    PERF_ADD(dataBytes, cmd != CMD);
+    TRACE_BYTE(byte, cmd == CMD);
     
     // Enable serial interface and indicate the start of data transmission by
     // selecting the display (slave) for use with SPI
-    CS_GLCD = 0;
+    PERF_SELECT();
+    GLCD_SELECT();
     
     spiSend(byte);
     
-    CS_GLCD = 1; // Deselect display
+    // Deselect display, unless more bytes are to follow in this transaction
+    if(!inTransaction){
+        GLCD_DESELECT();
+    }
+}
+
+void glcdBeginTransaction(void){
+    inTransaction = 1;
+    PERF_SELECT();
+    GLCD_SELECT();
+}
+
+void glcdEndTransaction(void){
+    inTransaction = 0;
+    GLCD_DESELECT();
 }
 
 void glcd_swreset(void){
     glcdTransfer(INST_SWRESET, CMD);
+    glcdInvalidateShadow();
     __delay_ms(130); // Delay specified on pg. 83 of datasheet
 }
 
 void glcd_slpin(void){
-    glcdTransfer(INST_SLPIN, CMD);
-    // Delay specified on pg. 93 of datasheet to stabilize power circuits
-    __delay_ms(130);
+    if(glcdWriteMode(SHADOW_SLEEP_OUT, 0, INST_SLPIN)){
+        // Delay specified on pg. 93 of datasheet to stabilize power circuits
+        __delay_ms(130);
+    }
 }
 
 void glcd_slpout(void){
-    glcdTransfer(INST_SLPOUT, CMD);
-    // Delay specified on pg. 94 of datasheet to stabilize timing for supply
-    // voltages and clock circuits
-    __delay_ms(130);
+    if(glcdWriteMode(SHADOW_SLEEP_OUT, 1, INST_SLPOUT)){
+        // Delay specified on pg. 94 of datasheet to stabilize timing for
+        // supply voltages and clock circuits
+        __delay_ms(130);
+    }
 }
 
 void glcd_setmadctl(void){
+    glcdUpdateOffsets();
+    if((shadow.valid & SHADOW_MADCTL) && (shadow.madctl == MADCTLbits.reg)){
+        PERF_ADD(skippedCommands, 1);
+        return;
+    }
     glcdTransfer(INST_MADCTL, CMD);
     glcdTransfer(MADCTLbits.reg, MEMWRITE);
+    shadow.madctl = MADCTLbits.reg;
+    shadow.valid |= SHADOW_MADCTL;
+    PERF_FORGET_WINDOW();
 }
 
 void glcd_ptlon(void){
-    glcdTransfer(INST_PTLON, CMD);
+    glcdWriteMode(SHADOW_PARTIAL, 1, INST_PTLON);
+    partialModeOn = 1;
 }
 
 void glcd_noron(void){
-    glcdTransfer(INST_NORON, CMD);
+    glcdWriteMode(SHADOW_PARTIAL, 0, INST_NORON);
+    shadow.valid &= ~SHADOW_VSCSAD; // Scrolling ends too
+    partialModeOn = 0;
 }
 
 void glcd_invoff(void){
-    glcdTransfer(INST_INVOFF, CMD);
+    glcdWriteMode(SHADOW_INVERT, 0, INST_INVOFF);
 }
 
 void glcd_invon(void){
-    glcdTransfer(INST_INVON, CMD);
+    glcdWriteMode(SHADOW_INVERT, 1, INST_INVON);
 }
 
 void glcd_dispoff(void){
-    glcdTransfer(INST_DISPOFF, CMD);
+    glcdWriteMode(SHADOW_DISPLAY_ON, 0, INST_DISPOFF);
 }
 
 void glcd_dispon(void){
-    glcdTransfer(INST_DISPON, CMD);
+    glcdWriteMode(SHADOW_DISPLAY_ON, 1, INST_DISPON);
 }
 
 void glcd_ramwr(void){
@@ -158,138 +977,319 @@ void glcd_ramwr(void){
 }
 
 void glcd_teoff(void){
-    glcdTransfer(INST_TEOFF, CMD);
+    glcdWriteMode(SHADOW_TE, 0, INST_TEOFF);
+}
+
+void glcd_teon(void){
+    if(glcdWriteMode(SHADOW_TE, 1, INST_TEON)){
+        glcdTransfer(TE_MODE_VBLANK, MEMWRITE);
+    }
 }
 
 void glcd_idmoff(void){
-    glcdTransfer(INST_IDMOFF, CMD);
+    glcdWriteMode(SHADOW_IDLE, 0, INST_IDMOFF);
 }
 
 void glcd_idmon(void){
-    glcdTransfer(INST_IDMON, CMD);
+    glcdWriteMode(SHADOW_IDLE, 1, INST_IDMON);
 }
 
-void glcdDrawRectangle(
+void glcdInvalidateShadow(void){
+    shadow.valid = 0;
+    PERF_FORGET_WINDOW();
+}
+
+void glcdForceResync(void){
+    glcd_state_t known = shadow;
+    glcdInvalidateShadow();
+    
+    // Sleep out comes first, since the other settings may not take while the
+    // controller is asleep
+    if(known.valid & SHADOW_SLEEP_OUT){
+        if(known.modes & SHADOW_SLEEP_OUT){
+            glcd_slpout();
+        }
+        else{
+            glcd_slpin();
+        }
+    }
+    glcdReplayState(&known);
+}
+
+void glcdSaveState(glcd_state_t* state){
+    *state = shadow;
+}
+
+void glcdRecover(const glcd_state_t* state, glcd_recovery_e level){
+    glcd_state_t known = *state;
+    
+    if(level == GLCD_RECOVER_RESET){
+        glcdTransfer(INST_SWRESET, CMD);
+        __delay_ms(RECOVER_SWRESET_MS);
+    }
+    glcdInvalidateShadow();
+    
+    // Leave sleep mode whatever the state, in case the glitch entered it
+    glcdWriteMode(SHADOW_SLEEP_OUT, 1, INST_SLPOUT);
+    __delay_ms(RECOVER_SLPOUT_MS);
+    
+    // The rest of initGLCD's setup, without its reset, delays and clear
+    glcdSetProfile(known.profile);
+    glcdSendPanelSetup();
+    glcdReplayState(&known);
+    if((known.valid & SHADOW_SLEEP_OUT) && !(known.modes & SHADOW_SLEEP_OUT)){
+        glcd_slpin();
+    }
+}
+
+void glcdEncodeWindow(
     unsigned char XS,
     unsigned char XE,
     unsigned char YS,
     unsigned char YE,
-    unsigned long color
+    unsigned char* window
 )
 {
-    // This first control flow structure is to issue "software fixes" for
-    // the rotation settings. These adjustments are performed to ensure that
-    // arguments for XS, XE, YS, and YE in the acceptable range will always
-    // be placed in display RAM that's pixel-mapped on our display panel.
-    // RECALL: The mirror/exchange effects (and effectively rotation) are 
-    // configured by the MADCTL register
-#if defined(V1_1)
-    if(MADCTLbits.MX == 1 && MADCTLbits.MV ==1){
-        // Case: origin top-left
-        YS += 3;
-        YE += 3;
-        XS += 2;
-        XE += 2;
-    }
-    else if(MADCTLbits.MY == 1){
-        // Case: origin top-right
-        YS += 2;
-        YE += 2;
-        XS += 3;
-        XE += 3;
-    }
-    else if(MADCTLbits.MX == 1){
-        // Case: origin bottom-left
-        YS += 2;
-        YE += 2;
-        XS += 1;
-        XE += 1;
-    }
-    else{
-        // Case: origin bottom-right
-        YS += 1;
-        YE += 1;
-        XS += 2;
-        XE += 2;
-    }
-#elif defined(V2_1)
-    if(MADCTLbits.MX == 1 && MADCTLbits.MV ==1){
-        // Case: origin top-left
-        YS += 32;
-        YE += 32;
-    }
-    else if(MADCTLbits.MY == 1){
-        // Case: origin top-right
-        XS += 32;
-        XE += 32;
-    }
-#else
-    #error "Must define either V1_1 or V2_1 in the GLCD's header file"
-#endif
+    // Apply the panel offsets for the current rotation settings. These
+    // adjustments are performed to ensure that arguments for XS, XE, YS, and
+    // YE in the acceptable range will always be placed in display RAM that's
+    // pixel-mapped on our display panel. They are recomputed by
+    // glcdUpdateOffsets every time MADCTL is written
+    XS += xOffset;
+    XE += xOffset;
+    YS += yOffset;
+    YE += yOffset;
     
     // Set row address counter (specifies the start (XS) and end (XE) positions
     // of the drawing window
-    glcdTransfer(INST_RASET, CMD);
-    glcdTransfer(0x00, MEMWRITE); // XS[15:8]
-    glcdTransfer(XS, MEMWRITE); // XS[7:0]
-    glcdTransfer(0x00, MEMWRITE); // XE[15:8]
-    glcdTransfer(XE - 1, MEMWRITE); // XE[7:0]
+    window[0] = INST_RASET;
+    window[1] = 0x00; // XS[15:8]
+    window[2] = XS; // XS[7:0]
+    window[3] = 0x00; // XE[15:8]
+    window[4] = XE - 1; // XE[7:0]
     
     // Set column address counter (specifies the start (YS) and end (YE)
     // positions of the drawing window
-    glcdTransfer(INST_CASET, CMD);
-    glcdTransfer(0x00, MEMWRITE); // YS[15:8]
-    glcdTransfer(YS, MEMWRITE); // YS[7:0]
-    glcdTransfer(0x00, MEMWRITE); // YE[15:8]
-    glcdTransfer(YE - 1, MEMWRITE); // YE[7:0]
+    window[5] = INST_CASET;
+    window[6] = 0x00; // YS[15:8]
+    window[7] = YS; // YS[7:0]
+    window[8] = 0x00; // YE[15:8]
+    window[9] = YE - 1; // YE[7:0]
     
-    glcd_ramwr(); // Send the RAM write command to the display controller.
+    window[10] = INST_RAMWR; // Enable writing to the display data RAM
+}
+
+void glcdEncodeColor(unsigned long color, unsigned char* colorData){
+    glcdEncodeColorAs(color, colmodBpp, colorData);
+}
+
+void glcdEncodeColorAs(
+    unsigned long color,
+    unsigned char bpp,
+    unsigned char* colorData
+)
+{
+    unsigned char blue = color & 0xFF;
+    unsigned char green = (color >> 8) & 0xFF;
+    unsigned char red = (color >> 16) & 0xFF;
+    
+    switch(bpp){
+        case 12:
+            colorData[0] = blue & 0xF0;
+            colorData[1] = green & 0xF0;
+            colorData[2] = red & 0xF0;
+            break;
+        case 16:
+            // B[7:3] G[7:5], G[4:2] R[7:3]
+            colorData[0] = (blue & 0xF8) | (green >> 5);
+            colorData[1] = ((green << 3) & 0xE0) | (red >> 3);
+            break;
+        default:
+            colorData[0] = blue; // Blue pixel data
+            colorData[1] = green; // Green pixel data
+            colorData[2] = red; // Red pixel data
+            break;
+    }
+}
+
+
+unsigned char glcdGetCOLMOD(void){
+    return colmodBpp;
+}
+
+void glcdDrawRectangle(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+)
+{
+    PROFILE_BEGIN();
     
-    // If only drawing one pixel...save the PIC processor the time for computing
-    // loop parameters
+    // A zero-size window is how glcdDrawPixel asks for a single pixel. Widen
+    // it to a 1 x 1 window so that the end addresses sent below are valid
     if((XE == XS) && (YE == YS)){
-        // Provide color data. This data will be passed as inputs to a look-up
-        // table (LUT) in the GLCD. The LUT will then output 18 bits of color
-        // to the location in data RAM specified by the row address pointer and
-        // column address pointer. The memory-mapped pixel will then take on
-        // the specified color configuration. Note that we do not have to send
-        // a command before doing this because the previous commands take care
-        // of all the require configuration details
-        glcdTransfer(color & 0xFF, MEMWRITE); // Blue pixel data
-        glcdTransfer((color >> 8) & 0xFF, MEMWRITE); // Green pixel data
-        glcdTransfer((color >> 16) & 0xFF, MEMWRITE); // Red pixel data
+        XE++;
+        YE++;
+    }
+    
+    // Skip the parts of the window that lie outside the partial display area,
+    // since the panel won't show them anyway
+    if(partialModeOn){
+        if(!glcdClipToPartialArea(&XS, &XE, &YS, &YE)){
+            PROFILE_END(PROF_DRAW_RECTANGLE);
+            return;
+        }
+    }
+    
+    glcdSendWindow(XS, XE, YS, YE);
+    
+    // Write color data to the GLCD for all the pixels in the window. Note
+    // that the GLCD controller auto-increments the addresses being written
+    // to in the RAM, which is why we can continuously write after
+    // specifying a window. Pre-compute the number of pixels since the
+    // multiplication would otherwise add an extra runtime step
+    unsigned short numPixels = (XE - XS) * (YE - YS);
+    glcdWritePixels(color, numPixels);
+    glcdEndPixels();
+    PROFILE_END(PROF_DRAW_RECTANGLE);
+}
+
+unsigned char glcdSetWindow(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+)
+{
+    PROFILE_BEGIN();
+    
+    // Pixel data can't be clipped, so the window is only skipped when all of
+    // it is outside the partial display area
+    if(partialModeOn){
+        unsigned char xs = XS, xe = XE, ys = YS, ye = YE;
+        if(!glcdClipToPartialArea(&xs, &xe, &ys, &ye)){
+            PROFILE_END(PROF_SET_WINDOW);
+            return 0;
+        }
+    }
+    
+    glcdSendWindow(XS, XE, YS, YE);
+    PROFILE_END(PROF_SET_WINDOW);
+    return 1;
+}
+
+void glcdWritePixels(unsigned long color, unsigned short numPixels){
+    if(numPixels == 0){
+        return;
+    }
+    PROFILE_BEGIN();
+    
+    // Extract data for the individual colors once, since doing this every
+    // time through the loops below would be slow. The loops also use spiSend
+    // directly as opposed to glcdTransfer to reduce function call overhead
+    unsigned char colorData[3];
+    glcdEncodeColor(color, colorData);
+    PERF_PIXELS(numPixels);
+    
+    PERF_SELECT();
+    GLCD_SELECT(); // Select GLCD as slave device
+    RS_GLCD = 1; // Select the display data RAM
+    if(colmodBpp == 16){
+        DATA_SENT(numPixels * 2UL);
+        for(unsigned short i = 0; i < numPixels; i++){
+            spiSend(colorData[0]);
+            spiSend(colorData[1]);
+        }
+    }
+    else if(colmodBpp == 12){
+        // Pixels go out in pairs: B1G1, R1B2, G2R2. Complete the pair left
+        // over from the last call first
+        if(pixelPending){
+            spiSend(pendingData[0]);
+            spiSend(pendingData[1] | (colorData[0] >> 4));
+            spiSend(colorData[1] | (colorData[2] >> 4));
+            DATA_SENT(3);
+            pixelPending = 0;
+            numPixels--;
+        }
+        unsigned char pairData[3];
+        pairData[0] = colorData[0] | (colorData[1] >> 4);
+        pairData[1] = colorData[2] | (colorData[0] >> 4);
+        pairData[2] = colorData[1] | (colorData[2] >> 4);
+        DATA_SENT((numPixels >> 1) * 3UL);
+        for(unsigned short i = numPixels >> 1; i > 0; i--){
+            spiSend(pairData[0]);
+            spiSend(pairData[1]);
+            spiSend(pairData[2]);
+        }
+        if(numPixels & 1){
+            // Keep the first half of the pair until the next pixel comes
+            pendingData[0] = pairData[0];
+            pendingData[1] = colorData[2];
+            pixelPending = 1;
+        }
     }
     else{
-        // Write color data to the GLCD for all the pixels in the window. Note
-        // that the GLCD controller auto-increments the addresses being written
-        // to in the RAM, which is why we can continuously write after
-        // specifying a window.
-        //
-        // Also, the following were done for efficiency:
-        //  1. Pre-compute number of loops (multiplication would add an extra
-        //     runtime step)
-        //  2. Extract data for individual colors from the argument (also slow
-        //     if you had to do this everytime you ran the loop)
-        //  3. Directly use the spiSend function as opposed to glcdTransfer to
-        //     reduce function call overhead
-        unsigned short numLoops = (XE - XS) * (YE - YS);
-        unsigned char colorData[3];
-        colorData[0] = color & 0xFF;
-        colorData[1] = (color >> 8) & 0xFF;
-        colorData[2] = (color >> 16) & 0xFF;
-        
-        CS_GLCD = 0; // Select GLCD as slave device
-        RS_GLCD = 1; // Select the display data RAM
-        for(unsigned short i = 0; i < numLoops; i++){
+        DATA_SENT(numPixels * 3UL);
+        for(unsigned short i = 0; i < numPixels; i++){
             spiSend(colorData[0]); // Blue pixel data
             spiSend(colorData[1]); // Green pixel data
             spiSend(colorData[2]); // Red pixel data
         }
-        CS_GLCD = 1; // Deselect the GLCD as slave device
+    }
+    PROFILE_END(PROF_WRITE_PIXELS);
+}
+
+void glcdWriteMonoPixels(
+    unsigned char bits,
+    unsigned char numPixels,
+    unsigned long fg,
+    unsigned long bg
+)
+{
+    // Send runs of the same color, since the color conversion is the slow part
+    while(numPixels > 0){
+        unsigned char bit = bits & 1;
+        unsigned char run = 0;
+        while((numPixels > 0) && ((bits & 1) == bit)){
+            bits >>= 1;
+            run++;
+            numPixels--;
+        }
+        glcdWritePixels(bit ? fg : bg, run);
+    }
+}
+
+void glcdWriteData(const unsigned char* data, unsigned short numBytes){
+    DATA_SENT(numBytes);
+    PERF_SELECT();
+    GLCD_SELECT(); // Select GLCD as slave device
+    RS_GLCD = 1; // Select the display data RAM
+    for(unsigned short i = 0; i < numBytes; i++){
+        spiSend(data[i]);
+    }
+}
+
+void glcdEndPixels(void){
+    if(pixelPending){
+        // The last pixel at 12 bpp is complete after 1.5 bytes. The rest of the
+        // second byte starts a pixel that is never finished, so it is dropped
+        RS_GLCD = 1;
+        spiSend(pendingData[0]);
+        spiSend(pendingData[1]);
+        DATA_SENT(2);
+        pixelPending = 0;
+    }
+    if(!inTransaction){
+        GLCD_DESELECT(); // Deselect the GLCD as slave device
     }
 }
 
 void glcdDrawPixel(unsigned char XS, unsigned char YS, unsigned long color){   
+    PROFILE_BEGIN();
+    
     // Take care of edge cases. Note that there is no less than zero edge case
     // due to the unsignedness of unsigned char causing overflow instead
     if(XS >= GLCD_SIZE_HORZ){
@@ -300,9 +1300,11 @@ void glcdDrawPixel(unsigned char XS, unsigned char YS, unsigned long color){
     }
     
     glcdDrawRectangle(XS, XS, YS, YS, color);
+    PROFILE_END(PROF_DRAW_PIXEL);
 }
 
 void glcdSetCOLMOD(unsigned char numBitsPerPixel){
+    PROFILE_BEGIN();
     unsigned short rawData;
     switch(numBitsPerPixel){
         case 12:
@@ -318,11 +1320,24 @@ void glcdSetCOLMOD(unsigned char numBitsPerPixel){
             rawData = 0b00000110; // case 18
             break;
     }
-    glcdTransfer(INST_COLMOD, CMD);
-    glcdTransfer(rawData, MEMWRITE);
+    if((shadow.valid & SHADOW_COLMOD) && (shadow.colmod == rawData)){
+        PERF_ADD(skippedCommands, 1);
+    }
+    else{
+        glcdTransfer(INST_COLMOD, CMD);
+        glcdTransfer(rawData, MEMWRITE);
+        shadow.colmod = rawData;
+        shadow.valid |= SHADOW_COLMOD;
+    }
+    
+    colmodBpp = (numBitsPerPixel == 12 || numBitsPerPixel == 16) ?
+        numBitsPerPixel : 18;
+    PROFILE_END(PROF_SET_COLMOD);
 }
 
 void glcdSetOrigin(glcd_origin_positions_e corner){
+    PROFILE_BEGIN();
+    
     // Set MADCTL bits to reflect the configuration
     switch(corner){
         case ORIGIN_TOP_LEFT:
@@ -353,13 +1368,438 @@ void glcdSetOrigin(glcd_origin_positions_e corner){
     }
     
     glcd_setmadctl(); // Push changes to GLCD
+    PROFILE_END(PROF_SET_ORIGIN);
+}
+
+unsigned char glcdBlit(
+    unsigned char x,
+    unsigned char y,
+    unsigned char width,
+    unsigned char height,
+    const unsigned char* data,
+    glcd_blit_transform_e transform
+)
+{
+    unsigned char placedWidth = (transform & BLIT_SWAP_XY) ? height : width;
+    unsigned char placedHeight = (transform & BLIT_SWAP_XY) ? width : height;
+    if((width == 0) || (height == 0) ||
+       ((unsigned short)x + placedWidth > GLCD_SIZE_HORZ) ||
+       ((unsigned short)y + placedHeight > GLCD_SIZE_VERT)){
+        return 0;
+    }
+    PROFILE_BEGIN();
+    
+    // Where the stored image's first pixel goes on the panel, and which way
+    // the next pixel along each of its axes goes
+    short col0, row0, col1, row1, col2, row2;
+    glcdMapImagePixel(x, y, width, height, transform, 0, 0, &col0, &row0);
+    glcdMapImagePixel(x, y, width, height, transform, 1, 0, &col1, &row1);
+    glcdMapImagePixel(x, y, width, height, transform, 0, 1, &col2, &row2);
+    
+    // Find the orientation in which writing the image unchanged does the
+    // same. Only MY, MX and MV are changed
+    unsigned char previous = MADCTLbits.reg;
+    unsigned char madctl = previous;
+    for(unsigned char m = 0; m < 8; m++){
+        madctl = (previous & 0x1F) | (m << 5);
+        short c0, r0, c1, r1, c2, r2;
+        glcdMapToPanel(madctl, 0, 0, &c0, &r0);
+        glcdMapToPanel(madctl, 1, 0, &c1, &r1);
+        glcdMapToPanel(madctl, 0, 1, &c2, &r2);
+        if((c1 - c0 == col1 - col0) && (r1 - r0 == row1 - row0) &&
+           (c2 - c0 == col2 - col0) && (r2 - r0 == row2 - row0)){
+            break;
+        }
+    }
+    short XS, YS;
+    glcdMapFromPanel(madctl, col0, row0, &XS, &YS);
+    
+    unsigned short numPixels = (unsigned short)width * height;
+    unsigned short numBytes;
+    switch(colmodBpp){
+        case 12:
+            numBytes = numPixels + ((numPixels + 1) >> 1);
+            break;
+        case 16:
+            numBytes = numPixels * 2;
+            break;
+        default:
+            numBytes = numPixels * 3;
+            break;
+    }
+    
+    unsigned char ownTransaction = !inTransaction;
+    if(ownTransaction){
+        glcdBeginTransaction();
+    }
+    if(madctl != previous){
+        MADCTLbits.reg = madctl;
+        glcd_setmadctl();
+    }
+    if(glcdSetWindow(XS, XS + width, YS, YS + height)){
+        glcdWriteData(data, numBytes);
+        PERF_PIXELS(numPixels);
+        glcdEndPixels();
+    }
+    if(madctl != previous){
+        MADCTLbits.reg = previous;
+        glcd_setmadctl();
+    }
+    if(ownTransaction){
+        glcdEndTransaction();
+    }
+    PROFILE_END(PROF_BLIT);
+    return 1;
+}
+
+void glcdSetPartialArea(unsigned char startRow, unsigned char endRow){
+    partialStart = startRow;
+    partialEnd = endRow;
+    
+    // PTLAR takes display RAM rows, so shift by the first row on the panel
+    unsigned char PSL = startRow + PANEL_ROW_ORIGIN;
+    unsigned char PEL = endRow + PANEL_ROW_ORIGIN;
+    if((shadow.valid & SHADOW_PTLAR) &&
+       (shadow.ptlar[0] == PSL) && (shadow.ptlar[1] == PEL)){
+        PERF_ADD(skippedCommands, 1);
+        return;
+    }
+    
+    glcdTransfer(INST_PTLAR, CMD);
+    glcdTransfer(0x00, MEMWRITE); // PSL[15:8]
+    glcdTransfer(PSL, MEMWRITE); // PSL[7:0]
+    glcdTransfer(0x00, MEMWRITE); // PEL[15:8]
+    glcdTransfer(PEL, MEMWRITE); // PEL[7:0]
+    shadow.ptlar[0] = PSL;
+    shadow.ptlar[1] = PEL;
+    shadow.valid |= SHADOW_PTLAR;
+}
+
+void glcdSetPartialFrameRate(
+    unsigned char RTNC,
+    unsigned char FPC,
+    unsigned char BPC
+)
+{
+    // One line period, front porch and back porch
+    const unsigned char frmctr3[3] = {RTNC & 0x0F, FPC & 0x3F, BPC & 0x3F};
+    glcdWriteFrameRate(INST_FRMCTR3, SHADOW_FRMCTR3, shadow.frmctr3, frmctr3);
+}
+
+void glcdEnterPartialMode(unsigned char startRow, unsigned char endRow){
+    glcdSetPartialArea(startRow, endRow);
+    glcd_ptlon();
+}
+
+void glcdExitPartialMode(void){
+    glcd_noron();
+}
+
+void glcdSetIdleFrameRate(
+    unsigned char RTNB,
+    unsigned char FPB,
+    unsigned char BPB
+)
+{
+    idleRTNB = RTNB & 0x0F;
+    idleFPB = FPB & 0x3F;
+    idleBPB = BPB & 0x3F;
+}
+
+void glcdEnterIdleMode(void){
+    // Configure the idle mode frame rate: line period, front and back porch
+    const unsigned char frmctr2[3] = {idleRTNB, idleFPB, idleBPB};
+    glcdWriteFrameRate(INST_FRMCTR2, SHADOW_FRMCTR2, shadow.frmctr2, frmctr2);
+    
+    // Only the MSB of each color component is displayed in idle mode, so the
+    // 12 bpp format loses nothing and costs the fewest bytes per pixel. The
+    // format in use is remembered even if it's already 12 bpp, so that
+    // glcdExitIdleMode goes back to it
+    normalBpp = colmodBpp;
+    if(colmodBpp != 12){
+        glcdSetCOLMOD(12);
+    }
+    
+    glcd_idmon();
+}
+
+void glcdExitIdleMode(void){
+    glcd_idmoff();
+    if(colmodBpp != normalBpp){
+        glcdSetCOLMOD(normalBpp);
+    }
+}
+
+unsigned long glcdColor3(glcd_color3_e color){
+    unsigned long rgb = 0;
+    if(color & C3_RED){
+        rgb |= 0xFF0000;
+    }
+    if(color & C3_GREEN){
+        rgb |= 0x00FF00;
+    }
+    if(color & C3_BLUE){
+        rgb |= 0x0000FF;
+    }
+    return rgb;
+}
+
+void glcdDrawRectangle3(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    glcd_color3_e color
+)
+{
+    glcdDrawRectangle(XS, XE, YS, YE, glcdColor3(color));
+}
+
+void glcdSetProfile(glcd_profile_e profile){
+    if(profile > GLCD_PROFILE_LOW_POWER){
+        profile = GLCD_PROFILE_HIGH_REFRESH;
+    }
+    const glcd_profile_t* p = &PROFILES[profile];
+    
+    // Keep the display selected for all of the commands, unless the caller
+    // already does
+    unsigned char ownTransaction = !inTransaction;
+    if(ownTransaction){
+        glcdBeginTransaction();
+    }
+    glcdWriteFrameRate(INST_FRMCTR1, SHADOW_FRMCTR1, shadow.frmctr1, p->frmctr1);
+    glcdWriteFrameRate(INST_FRMCTR2, SHADOW_FRMCTR2, shadow.frmctr2, p->frmctr2);
+    glcdWriteFrameRate(INST_FRMCTR3, SHADOW_FRMCTR3, shadow.frmctr3, p->frmctr3);
+    glcdWritePowerControl(profile);
+    if(ownTransaction){
+        glcdEndTransaction();
+    }
+    
+    // Remember the frame rates, for scan timing and idle mode
+    frameRTNA = p->frmctr1[0];
+    frameFPA = p->frmctr1[1];
+    frameBPA = p->frmctr1[2];
+    idleRTNB = p->frmctr2[0];
+    idleFPB = p->frmctr2[1];
+    idleBPB = p->frmctr2[2];
+    shadow.profile = profile;
+}
+
+unsigned short glcdGetProfileFrameRate(
+    glcd_profile_e profile,
+    glcd_frame_mode_e mode
+)
+{
+    if(profile > GLCD_PROFILE_LOW_POWER){
+        profile = GLCD_PROFILE_HIGH_REFRESH;
+    }
+    const glcd_profile_t* p = &PROFILES[profile];
+    switch(mode){
+        case FRAME_MODE_IDLE:
+            return glcdComputeFrameRate(p->frmctr2);
+        case FRAME_MODE_PARTIAL:
+            return glcdComputeFrameRate(p->frmctr3);
+        default:
+            return glcdComputeFrameRate(p->frmctr1);
+    }
+}
+
+unsigned short glcdGetFrameRate(void){
+    unsigned char params[3] = {frameRTNA, frameFPA, frameBPA};
+    return glcdComputeFrameRate(params);
+}
+
+void glcdEnableScroll(void){
+    glcdWriteScrollArea();
+    glcdScrollTo(0);
+}
+
+void glcdScrollTo(unsigned char first){
+    // When MY = 1, coordinates increase in the opposite direction to the
+    // panel rows, so the row at the start of the scroll area must be the one
+    // that comes just after the desired first line, in panel row order
+    first &= (GLCD_SIZE_VERT - 1);
+    unsigned char SSA = (MADCTLbits.MY == 1) ?
+        (GLCD_SIZE_VERT - first) & (GLCD_SIZE_VERT - 1) : first;
+    glcdWriteScrollStart(SSA + PANEL_ROW_ORIGIN);
+}
+
+glcd_axis_e glcdGetScrollAxis(void){
+    return (MADCTLbits.MV == 1) ? AXIS_Y : AXIS_X;
+}
+
+void glcdEnableVSync(void){
+    TRIS_TE_GLCD = 1; // TE is an output of the display controller
+    glcd_teon();
+}
+
+unsigned char glcdWaitForVSync(void){
+    // Give up after two frames, in case the TE line is not connected
+    unsigned long timeout = 2UL * glcdGetFrameLines() * glcdGetLinePeriod();
+    
+    // TE is high during vertical blanking, and the scan of the next frame
+    // starts on its falling edge. Wait for a complete blanking period so we
+    // don't sync to the tail end of one that is already in progress
+    while(TE_GLCD == 0){
+        if(timeout < SCAN_WAIT_STEP_US){
+            return 0;
+        }
+        __delay_us(SCAN_WAIT_STEP_US);
+        timeout -= SCAN_WAIT_STEP_US;
+    }
+    while(TE_GLCD == 1){
+        if(timeout < SCAN_WAIT_STEP_US){
+            return 0;
+        }
+        __delay_us(SCAN_WAIT_STEP_US);
+        timeout -= SCAN_WAIT_STEP_US;
+    }
+    return 1;
+}
+
+unsigned char glcdWaitForScanPast(unsigned char row){
+    if(!glcdWaitForVSync()){
+        return 0;
+    }
+    glcdWaitUs((unsigned long)(row + 1) * glcdGetLinePeriod());
+    return 1;
+}
+
+unsigned char glcdGetVSyncRowsPerFrame(unsigned char width){
+    // A chunk of rows is started just after the scan has passed its last row.
+    // The scan then comes back around to the chunk's first row one frame
+    // minus the chunk's height later, so writing the chunk must be done by
+    // then. Each row costs width pixels in the current interface pixel
+    // format (1.5, 2 or 3 bytes each), and the window setup is 11 bytes. The
+    // chunk can also start up to two polling steps late: one finding the
+    // edge of TE, and one rounding up the wait after it
+    unsigned long linePeriod = glcdGetLinePeriod();
+    unsigned long frameTime = glcdGetFrameLines() * linePeriod;
+    unsigned char bitsPerPixel = (colmodBpp == 18) ? 24 : colmodBpp;
+    unsigned long rowBytes = ((unsigned long)width * bitsPerPixel + 7) / 8;
+    unsigned long rowTime = glcdGetBusTime(rowBytes);
+    unsigned long setupTime = glcdGetBusTime(GLCD_WINDOW_SETUP_BYTES) +
+                              2 * SCAN_WAIT_STEP_US;
+    
+    if(frameTime <= setupTime + rowTime + linePeriod){
+        return 1; // Tearing can't be avoided, but make progress anyway
+    }
+    unsigned long rows = (frameTime - setupTime) / (rowTime + linePeriod);
+    return (rows > GLCD_SIZE_VERT) ? GLCD_SIZE_VERT : (unsigned char)rows;
+}
+
+void glcdDrawRectangleVSync(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+)
+{
+    if((XE == XS) && (YE == YS)){
+        XE++;
+        YE++;
+    }
+    
+    // Split the window into chunks of panel rows. Panel rows run along y when
+    // MV = 1, and along x otherwise
+    unsigned char* start = (MADCTLbits.MV == 1) ? &YS : &XS;
+    unsigned char* end = (MADCTLbits.MV == 1) ? &YE : &XE;
+    unsigned char width = (MADCTLbits.MV == 1) ? XE - XS : YE - YS;
+    unsigned char chunk = glcdGetVSyncRowsPerFrame(width);
+    unsigned char first = *start;
+    unsigned char last = *end;
+    
+    for(unsigned char u = first; u < last; u += chunk){
+        unsigned char uEnd = (last - u > chunk) ? u + chunk : last;
+        
+        // Start right behind the scan, once it has passed the chunk's last
+        // panel row (which is its first coordinate when mirrored)
+        unsigned char rowA = glcdToPanelRow(u);
+        unsigned char rowB = glcdToPanelRow(uEnd - 1);
+        glcdWaitForScanPast((rowA > rowB) ? rowA : rowB);
+
+        *start = u;
+        *end = uEnd;
+        glcdDrawRectangle(XS, XE, YS, YE, color);
+        
+        if(uEnd == last){
+            break; // Avoids overflow of u
+        }
+    }
+}
+
+#if defined(GLCD_PERF_COUNTERS)
+void glcdGetPerfCounters(glcd_perf_t* dst){
+    *dst = perf;
+    dst->bytes = perf.commandBytes + perf.dataBytes;
+}
+
+void glcdResetPerfCounters(void){
+    perf.bytes = 0;
+    perf.commandBytes = 0;
+    perf.dataBytes = 0;
+    perf.windowSetups = 0;
+    perf.redundantWindows = 0;
+    perf.csToggles = 0;
+    perf.pixels = 0;
+    perf.skippedCommands = 0;
+}
+#endif
+
+void glcdInitPanel(
+    glcd_panel_t* panel,
+    unsigned char mask,
+    glcd_panel_version_e version
+)
+{
+    memset(panel, 0, sizeof(glcd_panel_t));
+    panel->csMask = mask;
+    panel->version = (version == GLCD_PANEL_V2_1) ? version : GLCD_PANEL_V1_1;
+    panel->bpp = 18;
+    panel->normalBpp = 18;
+    panel->partialEnd = 127;
+    memcpy(panel->frmctr1, PROFILES[GLCD_PROFILE_HIGH_REFRESH].frmctr1, 3);
+    memcpy(panel->idle, PROFILES[GLCD_PROFILE_HIGH_REFRESH].frmctr2, 3);
+    
+    // Deselect the display now, so it doesn't pick up what is sent to the
+    // others while they're initialized
+    LAT_CS_GLCD |= mask;
+    TRIS_CS_PORT_GLCD &= ~mask;
+}
+
+void glcdSelectPanel(glcd_panel_t* panel){
+    // The handle pointer is kept in single, which may be in use
+    glcdSaveSelected();
+    single = panel;
+    glcdSelectPanels(&single, 1);
+}
+
+void glcdSelectPanels(glcd_panel_t* const* panels, unsigned char count){
+    if(count == 0){
+        return;
+    }
+    glcdSaveSelected();
+    
+    glcdLoadPanel(panels[0]);
+    csMask = panels[0]->csMask;
+    for(unsigned char i = 1; i < count; i++){
+        csMask |= panels[i]->csMask;
+        glcdMergeShadow(&panels[i]->state);
+    }
+    selected = panels;
+    numSelected = count;
+}
+
+unsigned char glcdGetSelectMask(void){
+    return csMask;
 }
 
 void initGLCD(void){        
     // Ensure pin I/O is correct
-    CS_GLCD = 1; // Deselect GLCD
+    GLCD_DESELECT(); // Deselect GLCD
     RS_GLCD = 1; // Set RS high
-    TRIS_CS_GLCD = 0; // Set CS data direction to output
+    TRIS_CS_PORT_GLCD &= ~csMask; // Set CS data direction to output
     TRIS_RS_GLCD = 0; // Set RS data direction to output
     
     // Start SPI module with maximum available clock frequency (FOSC / 4)
@@ -374,64 +1814,21 @@ void initGLCD(void){
     
     glcd_slpout(); // Force exit from sleep mode
     
-    // Configure frame rate (FR) registers
-    glcdTransfer(INST_FRMCTR1, CMD); // Issue command to configure normal mode FR
-    glcdTransfer(0x00, MEMWRITE); // Parameter 1
-    glcdTransfer(0x06, MEMWRITE); // Parameter 2
-    glcdTransfer(0x03, MEMWRITE); // Parameter 3
-    
-    glcdTransfer(INST_FRMCTR2, CMD); // Issue command to configure idle mode FR
-    glcdTransfer(0x01, MEMWRITE); // Parameter 1 (default)
-    glcdTransfer(0x2C, MEMWRITE); // Parameter 2 (default)
-    glcdTransfer(0x2D, MEMWRITE); // Parameter 3 (default)
-    
-    glcdTransfer(INST_FRMCTR3, CMD); // Issue command to configure partial mode FR
-    glcdTransfer(0x01, MEMWRITE); // Parameter 1 (default)
-    glcdTransfer(0x2C, MEMWRITE); // Parameter 2 (default)
-    glcdTransfer(0x2D, MEMWRITE); // Parameter 3 (default)
-    
-    glcdTransfer(INST_INVCTR, CMD); // Issue command to configure display inversion control
-    glcdTransfer(0x00, MEMWRITE); // No inversion
-    
-    // Configure power control
-    glcdTransfer(INST_PWCTR1, CMD); // Issue command to configure PWCTR1 register
-    glcdTransfer(0xA2, MEMWRITE); // Set GVDD to 3.9 V and AVDD to 5 V
-    glcdTransfer(0x02, MEMWRITE); // Set GVCL to -4.6 V
-    glcdTransfer(0x84, MEMWRITE); // Set FUNCTION to AUTO
+    // Configure frame rate (FR) and power control registers
+    glcdSetProfile(GLCD_PROFILE_HIGH_REFRESH);
     
-    glcdTransfer(INST_PWCTR2, CMD); // Issue command to configure power supply level
-    glcdTransfer(0xC5, MEMWRITE); // See datasheet pg.132 (default)
-    
-    glcdTransfer(INST_PWCTR3, CMD); // Issue command to configure op amp current for normal mode
-    glcdTransfer(0x0A, MEMWRITE); // See datasheet pg.134  (default)
-    glcdTransfer(0x00, MEMWRITE); // See datasheet pg. 134 (default)
-    
-    glcdTransfer(INST_PWCTR4, CMD); // Issue command to configure op amp current for idle mode
-    glcdTransfer(0x8A, MEMWRITE); // See datasheet pg.134  (default)
-    glcdTransfer(0x2A, MEMWRITE); // Clock frequency for voltage booster circuit divided by 2
-    
-    glcdTransfer(INST_PWCTR5, CMD); // Issue command to configure op amp current for partial mode
-    glcdTransfer(0x8A, MEMWRITE); // See datasheet pg.138  (default)
-    glcdTransfer(0x2A, MEMWRITE); // Clock frequency for voltage booster circuit divided by 2
-    
-    // VCOM Control
-    glcdTransfer(INST_VMCTR1, CMD); // Issue command to configure VCOM voltage setting
-    glcdTransfer(0x3C, MEMWRITE); // Important parameter for power circuits
+    // Display inversion control, VCOM voltage and gamma curve
+    glcdSendPanelSetup();
     
     glcd_invoff(); // Force no display inversion
-
+    
     /************************** User-defined options **************************/
-    // Configure pixel interface format. NOTE: If it is desired to improve the      
-    // performance of the display, you can set the display to use 12 bits of        
-    // color instead. The color definitions provided would then all need to be      
-    // changed, as well as some modifications to the glcdTransfer function where        
-    // the color data is being sent
+    // Configure pixel interface format. NOTE: If it is desired to improve the
+    // performance of the display, you can set the display to use 12 or 16 bits
+    // of color instead. The drawing functions encode the 24-bit color
+    // definitions in whichever format is in effect
     glcdSetCOLMOD(18); // Enforce default format: 18 bits of color per pixel
     
-    // Set gamma curve
-    glcdTransfer(INST_GAMSET, CMD); // Issue command to set gamma curve
-    glcdTransfer(0x01, MEMWRITE); // Gamma curve 2.2 (default)
-    
     glcd_idmoff(); // Force exit from idle mode (mandatory)
     
     glcd_noron(); // Force normal display mode (mandatory)
@@ -13,8 +13,7 @@
 #define GLCD_PIC_H
 
 /********************************* Includes **********************************/
-#include <xc.h>
-#include <configBits.h>
+#include "../HAL/HAL.h"
 
 /********************************** Macros ***********************************/
 // The GLCD's red PCB will have a version number printed on the back. You must
@@ -38,6 +37,35 @@
 #define CS_GLCD      LATDbits.LATD0   /**< Chip select     */
 #define TRIS_CS_GLCD TRISDbits.TRISD0 /**< TRIS for CS pin */
 
+// More displays can share the SPI bus, RS and TE, each with its own chip
+// select on the same port (see glcdSelectPanel). The driver selects displays
+// through the port's latch, with CS_GLCD_MASK being the bit of CS_GLCD
+#define LAT_CS_GLCD       LATD  /**< Latch with the chip selects */
+#define TRIS_CS_PORT_GLCD TRISD /**< TRIS of the chip selects' port */
+#define CS_GLCD_MASK      0x01  /**< CS_GLCD's bit in LAT_CS_GLCD */
+
+// RD2 is TE, the tearing effect output of the display controller. It is only
+// needed for the vsync functions, and is not used unless glcdEnableVSync is
+// called.
+//
+// TE = 1 --> display controller is in vertical blanking
+// TE = 0 --> display controller is scanning out the frame
+#define TE_GLCD      PORTDbits.RD2    /**< Tearing effect  */
+#define TRIS_TE_GLCD TRISDbits.TRISD2 /**< TRIS for TE pin */
+
+// Number of bytes sent to set up a drawing window (see glcdEncodeWindow): the
+// RASET, CASET, and RAMWR commands, and their parameters
+#define GLCD_WINDOW_SETUP_BYTES 11
+
+/** @brief 1 if byte i of a window setup is a command, 0 if it is a parameter */
+#define GLCD_WINDOW_IS_CMD(i) (((i) == 0) || ((i) == 5) || ((i) == 10))
+
+// Define this to have the driver count the bytes, windows and pixels it sends
+// (see glcdGetPerfCounters). Counting takes a few instructions per window and
+// per call that sends bytes. Without it, the counters and their functions are
+// compiled out entirely
+// #define GLCD_PERF_COUNTERS
+
 /******************************** Constants **********************************/
 // Display dimensions addressable in ST7735 controller display data RAM
 extern const unsigned char GLCD_ADDRESSABLE_SIZE_HORZ; /**< 128 pixels */
@@ -84,12 +112,124 @@ typedef enum{
     ORIGIN_BOTTOM_RIGHT
 }glcd_origin_positions_e;
 
+/**
+ * @brief The 8 colors shown in idle mode, one bit per color component. These
+ *        can be OR'd together (e.g. C3_RED | C3_GREEN is C3_YELLOW)
+ */
+typedef enum{
+    C3_BLACK = 0,
+    C3_RED = 1,
+    C3_GREEN = 2,
+    C3_YELLOW = 3,
+    C3_BLUE = 4,
+    C3_MAGENTA = 5,
+    C3_CYAN = 6,
+    C3_WHITE = 7
+}glcd_color3_e;
+
+/** @brief Frame rate and power trade-offs, for use with glcdSetProfile */
+typedef enum{
+    GLCD_PROFILE_HIGH_REFRESH, /**< Fastest refresh (initGLCD's default) */
+    GLCD_PROFILE_BALANCED,     /**< Datasheet default frame rates */
+    GLCD_PROFILE_LOW_POWER     /**< Slowest refresh, smallest op amp currents */
+}glcd_profile_e;
+
+/**
+ * @brief The controller settings the driver has written, as saved by
+ *        glcdSaveState for glcdRecover. The members are for the driver's use
+ */
+typedef struct{
+    unsigned short valid;  /**< Settings that have been written */
+    unsigned char modes;   /**< On/off modes that are on */
+    unsigned char madctl;  /**< MADCTL */
+    unsigned char colmod;  /**< COLMOD */
+    unsigned char ptlar[2];   /**< PSL[7:0] and PEL[7:0] of PTLAR */
+    unsigned char frmctr1[3]; /**< Normal mode frame rate */
+    unsigned char frmctr2[3]; /**< Idle mode frame rate */
+    unsigned char frmctr3[3]; /**< Partial mode frame rate */
+    unsigned char ssa;        /**< SSA[7:0] of VSCSAD, while scrolling */
+    glcd_profile_e profile;   /**< Last set with glcdSetProfile */
+}glcd_state_t;
+
+/** @brief The GLCD PCB versions, which place the panel differently */
+typedef enum{
+    GLCD_PANEL_V1_1, /**< 132 x 162 display RAM */
+    GLCD_PANEL_V2_1  /**< 128 x 160 display RAM */
+}glcd_panel_version_e;
+
+/**
+ * @brief A display on the shared bus, set up with glcdInitPanel. While not
+ *        selected, it holds the driver's state for that display. The members
+ *        after version are for the driver's use
+ */
+typedef struct{
+    unsigned char csMask;         /**< Chip select bit(s) in LAT_CS_GLCD */
+    glcd_panel_version_e version;
+    glcd_state_t state;           /**< Shadow of its settings */
+    unsigned char madctl;         /**< Orientation */
+    unsigned char bpp;            /**< Interface pixel format */
+    unsigned char normalBpp;      /**< Format to restore after idle mode */
+    unsigned char partialStart;
+    unsigned char partialEnd;
+    unsigned char partialModeOn;
+    unsigned char frmctr1[3];     /**< Normal mode frame rate */
+    unsigned char idle[3];        /**< Idle mode frame rate to use */
+}glcd_panel_t;
+
+/** @brief How much glcdRecover does */
+typedef enum{
+    GLCD_RECOVER_RESYNC, /**< Rewrites the settings (about 5 ms) */
+    GLCD_RECOVER_RESET   /**< Software reset first (about 125 ms) */
+}glcd_recovery_e;
+
+/** @brief Display modes that each have their own frame rate */
+typedef enum{
+    FRAME_MODE_NORMAL,  /**< Full colors (FRMCTR1) */
+    FRAME_MODE_IDLE,    /**< 8 colors (FRMCTR2) */
+    FRAME_MODE_PARTIAL  /**< Partial mode, full colors (FRMCTR3) */
+}glcd_frame_mode_e;
+
+/** @brief Axes of the drawing coordinates */
+typedef enum{
+    AXIS_X,
+    AXIS_Y
+}glcd_axis_e;
+
+/**
+ * @brief How glcdBlit places an image. The flags can be combined: the axes are
+ *        exchanged first, then mirrored. Rotations are clockwise when x
+ *        increases to the right and y increases downward
+ */
+typedef enum{
+    BLIT_NORMAL = 0,     /**< As stored */
+    BLIT_MIRROR_X = 1,   /**< Flipped along the x-axis */
+    BLIT_MIRROR_Y = 2,   /**< Flipped along the y-axis */
+    BLIT_SWAP_XY = 4,    /**< Transposed */
+    BLIT_ROTATE_90 = BLIT_SWAP_XY | BLIT_MIRROR_X,
+    BLIT_ROTATE_180 = BLIT_MIRROR_X | BLIT_MIRROR_Y,
+    BLIT_ROTATE_270 = BLIT_SWAP_XY | BLIT_MIRROR_Y
+}glcd_blit_transform_e;
+
 /** @brief Arguments for low-level driver, glcdTransfer */
 typedef enum{
     MEMWRITE = 0, /**< Data to be written into RAM (picture data, etc.) */
     CMD = 1       /**< A command for the GLCD controller */
 }glcd_transfer_mode_e;
 
+#if defined(GLCD_PERF_COUNTERS)
+/** @brief What the driver has sent since its counters were last reset */
+typedef struct{
+    unsigned long bytes;            /**< Bytes sent to the display */
+    unsigned long commandBytes;     /**< Bytes sent with RS low */
+    unsigned long dataBytes;        /**< Bytes sent with RS high */
+    unsigned long windowSetups;     /**< Drawing windows set */
+    unsigned long redundantWindows; /**< Windows the same as the one before */
+    unsigned long csToggles;        /**< Times the display was selected */
+    unsigned long pixels;           /**< Pixels written */
+    unsigned long skippedCommands;  /**< Mode writes that changed nothing */
+}glcd_perf_t;
+#endif
+
 /************************ Public Function Prototypes *************************/
 /**
  * @brief Driver to interface with the SPI module to send data to the GLCD.
@@ -101,6 +241,15 @@ typedef enum{
  */
 void glcdTransfer(unsigned char byte, glcd_transfer_mode_e cmd);
 
+/**
+ * @brief Selects the display until glcdEndTransaction is called, so that
+ *        several commands can be sent without toggling CS for each byte
+ */
+void glcdBeginTransaction(void);
+
+/** @brief Deselects the display at the end of a transaction */
+void glcdEndTransaction(void);
+
 /** @brief Sets all registers to their default value */
 void glcd_swreset(void);
 
@@ -113,7 +262,10 @@ void glcd_slpout(void);
 /** @brief Sets the mirror/exchange parameters */
 void glcd_setmadctl(void);
 
-/** @brief Turns on partial mode */
+/**
+ * @brief Turns on partial mode. Only the rows set by glcdSetPartialArea are
+ *        refreshed, and drawing outside of them is skipped
+ */
 void glcd_ptlon(void);
 
 /** @brief Turns off partial mode (normal) */
@@ -137,12 +289,62 @@ void glcd_ramwr(void);
 /** @brief Turns off the tearing effect */
 void glcd_teoff(void);
 
+/** @brief Turns on the tearing effect output (pulses during V-blanking) */
+void glcd_teon(void);
+
 /** @brief Stops display idling */
 void glcd_idmoff(void);
 
 /** @brief Starts display idling */
 void glcd_idmon(void);
 
+/**
+ * @brief Forgets what the driver knows of the controller's mode registers
+ * @details The driver keeps a shadow of the mode registers it writes (MADCTL,
+ *          COLMOD, PTLAR, FRMCTR1 to 3, PWCTR1 to 5, SCRLAR, VSCSAD, and the
+ *          sleep, partial, inversion, display, idle and tearing effect modes),
+ *          and skips writes that wouldn't change them. Call this if the controller may have been
+ *          changed without the driver knowing, e.g. by an external reset, so
+ *          that the next write of each register is sent
+ */
+void glcdInvalidateShadow(void);
+
+/**
+ * @brief Sends every setting in the shadow to the controller again, e.g. after
+ *        an external reset returned them to their defaults. Settings the
+ *        driver has not written since the last software reset are left alone
+ */
+void glcdForceResync(void);
+
+/**
+ * @brief Saves the settings the driver has written, e.g. once the display is
+ *        set up and known to be working, for glcdRecover
+ * @param state Where to save them
+ */
+void glcdSaveState(glcd_state_t* state);
+
+/**
+ * @brief Brings a display that glitched (e.g. from ESD or a brown-out of its
+ *        supply) back to a saved state, much faster than initGLCD
+ * @details Leaves sleep mode, rewrites the frame rate and power settings,
+ *          the panel settings initGLCD sends, and everything in the saved
+ *          state (including a partial frame rate from glcdSetPartialFrameRate
+ *          and the scroll area and position), then takes on its orientation,
+ *          pixel format and partial area. Unlike initGLCD, the screen is not cleared, since display RAM
+ *          is kept through a software reset: only the areas that may have been
+ *          damaged need to be redrawn, e.g. with GLCD_Dirty:
+ *          @code
+ *          glcdRecover(&goodState, GLCD_RECOVER_RESYNC);
+ *          glcdMarkDirty(XS, XE, YS, YE); // Or glcdMarkAllDirty()
+ *          glcdFlushDirty();
+ *          @endcode
+ * @param state The state, from glcdSaveState
+ * @param level GLCD_RECOVER_RESYNC if the controller still responds, or
+ *        GLCD_RECOVER_RESET to start from a software reset when its registers
+ *        can't be trusted
+ */
+void glcdRecover(const glcd_state_t* state, glcd_recovery_e level);
+
 /**
  * @brief Draws a solid rectangle in the specified window
  * @param XS Start position on the x-axis (min: 0, max: GLCD_SIZE_HORZ)
@@ -159,6 +361,108 @@ void glcdDrawRectangle(
     unsigned long color
 );
 
+/**
+ * @brief Computes the bytes that set up a drawing window, without sending
+ *        them. Used to send windows from somewhere other than the drawing
+ *        functions, such as an interrupt
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param window GLCD_WINDOW_SETUP_BYTES bytes, which are commands or
+ *        parameters according to GLCD_WINDOW_IS_CMD
+ */
+void glcdEncodeWindow(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned char* window
+);
+
+/**
+ * @brief Encodes a color in the current interface pixel format
+ * @param color The 24-bit color
+ * @param colorData 3 bytes. At 18 bpp, these are sent in order for each pixel.
+ *        At 16 bpp, only the first 2 are used. At 12 bpp, they hold the upper
+ *        nibbles of the blue, green, and red components, which are packed two
+ *        pixels to three bytes as B1G1, R1B2, G2R2
+ */
+void glcdEncodeColor(unsigned long color, unsigned char* colorData);
+
+/**
+ * @brief Encodes a color in a given interface pixel format, e.g. one that was
+ *        in effect when data was recorded (see glcdEncodeColor)
+ * @param color The 24-bit color
+ * @param bpp The interface pixel format: 12, 16, or 18
+ * @param colorData 3 bytes, as for glcdEncodeColor
+ */
+void glcdEncodeColorAs(
+    unsigned long color,
+    unsigned char bpp,
+    unsigned char* colorData
+);
+
+/**
+ * @brief Gets the interface pixel format set by glcdSetCOLMOD
+ * @return Bits per pixel (12, 16, or 18)
+ */
+unsigned char glcdGetCOLMOD(void);
+
+/**
+ * @brief Sets the drawing window for glcdWritePixels. Pixels are written with
+ *        the y-coordinate incrementing first, and the x-coordinate
+ *        incrementing each time the end of the window on the y-axis is reached
+ * @param XS Start position on the x-axis (min: 0, max: GLCD_SIZE_HORZ - 1)
+ * @param XE End position on the x-axis, exclusive (min: XS + 1, max:
+ *        GLCD_SIZE_HORZ)
+ * @param YS Start position on the y-axis (min: 0, max GLCD_SIZE_VERT - 1)
+ * @param YE End position on the y-axis, exclusive (min: YS + 1, max:
+ *        GLCD_SIZE_VERT)
+ * @return 0 if the window is outside the partial display area while partial
+ *         mode is on, in which case no pixels need to be written, otherwise 1
+ */
+unsigned char glcdSetWindow(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE
+);
+
+/**
+ * @brief Writes the same color to consecutive pixels of the drawing window
+ * @note The display stays selected until glcdEndPixels is called, so the SPI
+ *       bus must not be used for anything else in between
+ * @param color Color of the pixels
+ * @param numPixels Number of pixels to write
+ */
+void glcdWritePixels(unsigned long color, unsigned short numPixels);
+
+/**
+ * @brief Writes up to 8 pixels of the drawing window in one of two colors
+ * @param bits One bit per pixel, LSb first (1 --> fg, 0 --> bg)
+ * @param numPixels Number of pixels to write (max: 8)
+ * @param fg Color of the pixels whose bit is 1
+ * @param bg Color of the pixels whose bit is 0
+ */
+void glcdWriteMonoPixels(
+    unsigned char bits,
+    unsigned char numPixels,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @brief Writes pixel data that is already in the interface pixel format to
+ *        the drawing window
+ * @param data The pixel data
+ * @param numBytes Number of bytes
+ */
+void glcdWriteData(const unsigned char* data, unsigned short numBytes);
+
+/** @brief Finishes writing pixels to the drawing window */
+void glcdEndPixels(void);
+
 /**
  * @brief Draws the color specified at the coordinates specified relative to
  *        the origin
@@ -169,7 +473,9 @@ void glcdDrawRectangle(
 void glcdDrawPixel(unsigned char XS, unsigned char YS, unsigned long color);
 
 /**
- * @brief Sets the interface pixel format. Default is 18 bits per pixel (bpp)
+ * @brief Sets the interface pixel format. Default is 18 bits per pixel (bpp).
+ *        Colors are converted to this format by the drawing functions, which
+ *        send 3 bytes per pixel at 18 bpp, 2 at 16 bpp, and 1.5 at 12 bpp
  * @param numBitsPerPixel Desired color depth. Must be 12, 16, or 18 (bpp).
  *        Defaults to 18
  */
@@ -182,6 +488,278 @@ void glcdSetCOLMOD(unsigned char numBitsPerPixel);
  */
 void glcdSetOrigin(glcd_origin_positions_e corner);
 
+/**
+ * @brief Copies an image to the display, optionally rotated or mirrored
+ * @details Rather than reordering the pixels in software, MADCTL is changed
+ *          for the duration of the copy so that the controller places the
+ *          pixels, which are sent in the order they're stored. The window is
+ *          converted to the temporary orientation (including the panel
+ *          offsets), and the previous orientation is restored afterwards,
+ *          all within one transaction
+ * @param x x-position of the placed image's first column
+ * @param y y-position of the placed image's first row
+ * @param width Width of the image as stored (along x)
+ * @param height Height of the image as stored (along y)
+ * @param data The pixels, already encoded in the interface pixel format, in
+ *        the order a window is filled (see glcdSetWindow)
+ * @param transform How to place the image. With BLIT_SWAP_XY, the placed
+ *        image is height pixels wide and width pixels tall
+ * @return 0 if the placed image doesn't fit on the display (nothing is
+ *         drawn), otherwise 1
+ */
+unsigned char glcdBlit(
+    unsigned char x,
+    unsigned char y,
+    unsigned char width,
+    unsigned char height,
+    const unsigned char* data,
+    glcd_blit_transform_e transform
+);
+
+/**
+ * @brief Sets the rows that stay active in partial mode
+ * @details Rows are panel rows, numbered in the order the panel scans them
+ *          (0 to GLCD_SIZE_VERT - 1). This numbering does not change with
+ *          glcdSetOrigin; depending on the origin, panel rows run along either
+ *          the x- or the y-axis. While partial mode is on, the parts of
+ *          rectangles and pixels that fall outside of these rows are not sent
+ * @param startRow First active row
+ * @param endRow Last active row. If less than startRow, the area wraps around
+ *        the end of the panel, and drawing is no longer clipped to it
+ */
+void glcdSetPartialArea(unsigned char startRow, unsigned char endRow);
+
+/**
+ * @brief Sets the frame rate used in partial mode (FRMCTR3). The frame rate is
+ *        fosc / ((RTNC x 2 + 40) x (LINE + FPC + BPC + 2))
+ * @param RTNC One line period (min: 0, max: 15)
+ * @param FPC Front porch lines (min: 2, max: 63)
+ * @param BPC Back porch lines (min: 2, max: 63)
+ */
+void glcdSetPartialFrameRate(
+    unsigned char RTNC,
+    unsigned char FPC,
+    unsigned char BPC
+);
+
+/**
+ * @brief Sets the partial display area and turns on partial mode
+ * @param startRow First active row (see glcdSetPartialArea)
+ * @param endRow Last active row (see glcdSetPartialArea)
+ */
+void glcdEnterPartialMode(unsigned char startRow, unsigned char endRow);
+
+/** @brief Returns to normal (full screen) display mode */
+void glcdExitPartialMode(void);
+
+/**
+ * @brief Sets the frame rate used in idle mode (FRMCTR2), which is sent the
+ *        next time glcdEnterIdleMode is called. The frame rate is
+ *        fosc / ((RTNB x 2 + 40) x (LINE + FPB + BPB + 2))
+ * @param RTNB One line period (min: 0, max: 15)
+ * @param FPB Front porch lines (min: 2, max: 63)
+ * @param BPB Back porch lines (min: 2, max: 63)
+ */
+void glcdSetIdleFrameRate(
+    unsigned char RTNB,
+    unsigned char FPB,
+    unsigned char BPB
+);
+
+/**
+ * @brief Enters the low-power, 8-color idle mode. Sends the idle frame rate,
+ *        and switches to the 12 bpp interface pixel format, so that drawing
+ *        costs 1.5 bytes per pixel
+ */
+void glcdEnterIdleMode(void);
+
+/** @brief Leaves idle mode, restoring the previous interface pixel format */
+void glcdExitIdleMode(void);
+
+/**
+ * @brief Converts one of the 8 idle mode colors into a 24-bit color
+ * @param color The 3-bit color
+ * @return The equivalent color, for use with the other drawing functions
+ */
+unsigned long glcdColor3(glcd_color3_e color);
+
+/**
+ * @brief Draws a solid rectangle in one of the 8 idle mode colors
+ * @param XS Start position on the x-axis (min: 0, max: GLCD_SIZE_HORZ)
+ * @param XE End position on the x-axis (min: XS, max: GLCD_SIZE_HORZ)
+ * @param YS Start position on the y-axis (min: 0, max GLCD_SIZE_VERT)
+ * @param YE End position on the y-axis (min: YS, max: GLCD_SIZE_VERT)
+ * @param color 3-bit color of the rectangle
+ */
+void glcdDrawRectangle3(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    glcd_color3_e color
+);
+
+/**
+ * @brief Writes the frame rate (FRMCTR1 to 3) and power control (PWCTR1 to
+ *        5) registers for a profile, in a single transaction. Registers that
+ *        already hold the profile's values are skipped
+ * @note Idle frame rates set with glcdSetIdleFrameRate, and the partial frame
+ *       rate set with glcdSetPartialFrameRate, are replaced by the profile's
+ * @param profile The profile to apply
+ */
+void glcdSetProfile(glcd_profile_e profile);
+
+/**
+ * @brief Computes the frame rate of a profile
+ * @param profile The profile
+ * @param mode The display mode whose frame rate is desired
+ * @return Frame rate, in Hz
+ */
+unsigned short glcdGetProfileFrameRate(
+    glcd_profile_e profile,
+    glcd_frame_mode_e mode
+);
+
+/**
+ * @brief Computes the frame rate currently in effect for normal mode
+ * @return Frame rate, in Hz
+ */
+unsigned short glcdGetFrameRate(void);
+
+/**
+ * @brief Sets up the whole panel as the vertical scroll area, and scrolls to
+ *        the start of it. Scrolling moves the image along the panel rows,
+ *        which run along the axis reported by glcdGetScrollAxis
+ */
+void glcdEnableScroll(void);
+
+/**
+ * @brief Scrolls the display, without redrawing anything. The image wraps
+ *        around, so the lines before the first one appear at the end
+ * @note glcdEnableScroll must be called first. Scrolling ends with glcd_noron
+ * @param first The coordinate (x or y, see glcdGetScrollAxis) of the line to
+ *        be shown at the start of the display
+ */
+void glcdScrollTo(unsigned char first);
+
+/**
+ * @brief Reports which axis hardware scrolling moves along, which depends on
+ *        the origin set with glcdSetOrigin
+ * @return AXIS_Y for ORIGIN_TOP_LEFT and ORIGIN_BOTTOM_RIGHT, AXIS_X otherwise
+ */
+glcd_axis_e glcdGetScrollAxis(void);
+
+/** @brief Configures the TE pin as an input and turns on the TE output */
+void glcdEnableVSync(void);
+
+/**
+ * @brief Waits for the start of the next frame, as signalled by the falling
+ *        edge at the end of a TE pulse
+ * @return 1 if the frame start was found, 0 if TE did not toggle within two
+ *         frames (e.g. glcdEnableVSync was not called or TE is not wired)
+ */
+unsigned char glcdWaitForVSync(void);
+
+/**
+ * @brief Waits until the controller has just finished scanning a panel row
+ * @param row Panel row (0 to GLCD_SIZE_VERT - 1, see glcdSetPartialArea)
+ * @return 1 on success, 0 if TE could not be found (see glcdWaitForVSync)
+ */
+unsigned char glcdWaitForScanPast(unsigned char row);
+
+/**
+ * @brief Computes how many panel rows of a window can be written in one frame
+ *        without the scan catching up to the write, at the current SPI
+ *        clock (see spi_byte_cycles)
+ * @param width Number of pixels per panel row in the window
+ * @return Rows per frame (at least 1)
+ */
+unsigned char glcdGetVSyncRowsPerFrame(unsigned char width);
+
+/**
+ * @brief Draws a solid rectangle without tearing. The rectangle is split into
+ *        chunks of panel rows, and each chunk is written right behind the
+ *        controller's scan position, in its own frame
+ * @note Requires glcdEnableVSync. Takes at least one frame per chunk
+ * @param XS Start position on the x-axis (min: 0, max: GLCD_SIZE_HORZ)
+ * @param XE End position on the x-axis (min: XS, max: GLCD_SIZE_HORZ)
+ * @param YS Start position on the y-axis (min: 0, max GLCD_SIZE_VERT)
+ * @param YE End position on the y-axis (min: YS, max: GLCD_SIZE_VERT)
+ * @param color Color of the rectangle
+ */
+void glcdDrawRectangleVSync(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+);
+
+#if defined(GLCD_PERF_COUNTERS)
+/**
+ * @brief Takes a snapshot of the performance counters
+ * @details Everything the driver sends is counted, except for what
+ *          GLCD_Queue sends from the MSSP interrupt, which goes straight to
+ *          the SPI module (see spiGetByteCount). A window counts as
+ *          redundant if it has the same addresses as the one set before it,
+ *          with no change of orientation in between
+ * @param perf Where to put the counters
+ */
+void glcdGetPerfCounters(glcd_perf_t* perf);
+
+/** @brief Sets the performance counters to 0 */
+void glcdResetPerfCounters(void);
+#endif
+
+/**
+ * @brief Sets up the handle of a display, for glcdSelectPanel. Select it and
+ *        call initGLCD to initialize the display itself
+ * @details Its chip select pin is driven high and made an output right away,
+ *          so set up every handle before initializing any of the displays
+ * @param panel The handle
+ * @param mask Its chip select bit in LAT_CS_GLCD (e.g. CS_GLCD_MASK)
+ * @param version Its PCB version
+ */
+void glcdInitPanel(
+    glcd_panel_t* panel,
+    unsigned char mask,
+    glcd_panel_version_e version
+);
+
+/**
+ * @brief Makes the driver draw to another display. The state of the display
+ *        that was selected (orientation, pixel format, shadow, ...) is saved
+ *        in its handle, and that of the new one loaded from its handle
+ * @note Not to be called during a transaction, or while GLCD_Queue is
+ *       sending. Once handles are in use, every display needs one: the state
+ *       the driver had before the first call is not kept
+ * @param panel The display. Must stay valid while selected
+ */
+void glcdSelectPanel(glcd_panel_t* panel);
+
+/**
+ * @brief Selects several displays at once, so that what's sent goes to all
+ *        of them in a single transfer, e.g. to initialize them, or to draw
+ *        backgrounds and widgets they have in common
+ * @details All of their chip selects are pulled low together. The first
+ *          display's state is used for drawing, so the displays should be the
+ *          same version and have the same orientation. Settings are only
+ *          skipped when the shadows of all of the displays agree, and when
+ *          another display is selected, every one of them takes on the
+ *          resulting state
+ * @note Same restrictions as glcdSelectPanel
+ * @param panels The displays. The array must stay valid while selected
+ * @param count Number of displays
+ */
+void glcdSelectPanels(glcd_panel_t* const* panels, unsigned char count);
+
+/**
+ * @brief Gets the chip select bits of the display(s) selected
+ * @return The bits in LAT_CS_GLCD, CS_GLCD_MASK unless glcdSelectPanel has
+ *         been used
+ */
+unsigned char glcdGetSelectMask(void);
+
 /**
  * @brief Performs the GLCD initialization sequence
  * @note Credits go to Sumotoy for the power initialization parameters. These
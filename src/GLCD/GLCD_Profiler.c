@@ -0,0 +1,93 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Profiler
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Profiler.h"
+
+#if defined(GLCD_PROFILER)
+
+/******************************** Constants **********************************/
+// Names used in the report, in the order of glcd_prof_primitive_e
+static const char* const NAMES[PROF_NUM_PRIMITIVES] = {
+    "rect",
+    "pixel",
+    "window",
+    "wrpix",
+    "blit",
+    "char",
+    "string",
+    "origin",
+    "colmod"
+};
+
+/***************************** Private Variables *****************************/
+static glcd_prof_stats_t stats[PROF_NUM_PRIMITIVES];
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Sends a number over the EUSART in decimal, preceded by a space
+ * @param n The number
+ */
+static void profilerPutNumber(unsigned long n){
+    char digits[11];
+    unsigned char i = sizeof(digits);
+    digits[--i] = '\0';
+    do{
+        digits[--i] = '0' + (n % 10);
+        n /= 10;
+    }while(n > 0);
+    halUartPutc(' ');
+    halUartPuts(&digits[i]);
+}
+
+/***************************** Public Functions ******************************/
+void glcdProfilerRecord(glcd_prof_primitive_e primitive, unsigned long start){
+    unsigned long cycles = halGetTickLong() - start;
+    
+    glcd_prof_stats_t* s = &stats[primitive];
+    if((s->calls == 0) || (cycles < s->minCycles)){
+        s->minCycles = cycles;
+    }
+    s->calls++;
+    s->totalCycles += cycles;
+    if(cycles > s->maxCycles){
+        s->maxCycles = cycles;
+    }
+}
+
+void glcdProfilerGet(glcd_prof_primitive_e primitive, glcd_prof_stats_t* dst){
+    *dst = stats[primitive];
+}
+
+void glcdProfilerReset(void){
+    for(unsigned char i = 0; i < PROF_NUM_PRIMITIVES; i++){
+        stats[i].calls = 0;
+        stats[i].minCycles = 0;
+        stats[i].maxCycles = 0;
+        stats[i].totalCycles = 0;
+    }
+}
+
+void glcdProfilerReport(void){
+    halUartPuts("call calls min max avg total\r\n");
+    for(unsigned char i = 0; i < PROF_NUM_PRIMITIVES; i++){
+        const glcd_prof_stats_t* s = &stats[i];
+        if(s->calls == 0){
+            continue;
+        }
+        halUartPuts(NAMES[i]);
+        profilerPutNumber(s->calls);
+        profilerPutNumber(s->minCycles);
+        profilerPutNumber(s->maxCycles);
+        profilerPutNumber(s->totalCycles / s->calls);
+        profilerPutNumber(s->totalCycles);
+        halUartPuts("\r\n");
+    }
+}
+
+#endif /* GLCD_PROFILER */
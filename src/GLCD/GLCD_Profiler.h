@@ -0,0 +1,117 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Profiler
+ * @brief Measures the time taken by each of the driver's drawing calls
+ * @details When GLCD_PROFILER is defined, the drawing calls listed in
+ *          glcd_prof_primitive_e read the tick (TMR1, see HAL.h) on entry
+ *          and exit, and the elapsed instruction cycles are added to the
+ *          statistics of their primitive: number of calls, and the minimum,
+ *          maximum and total cycles. Unlike byte counts, this includes the
+ *          CPU time spent in the driver between bytes, e.g. converting colors
+ *          and computing offsets.
+ *
+ *          Calls made from inside another call are timed too, so e.g. every
+ *          glcdDrawPixel also counts as a glcdDrawRectangle. Each measurement
+ *          includes a few tens of cycles of overhead for reading the tick and
+ *          recording the result.
+ *
+ *          Calls shorter than 65536 cycles are always measured correctly.
+ *          Longer ones are measured correctly only if the application enables
+ *          the tick's overflow interrupt with halTickEnableOverflow, and
+ *          services it:
+ *          @code
+ *          if(tick_int_pending()){
+ *              halTickServiceISR();
+ *          }
+ *          @endcode
+ *
+ *          On a PC, the tick is simulated. It counts time spent on the SPI
+ *          bus, including SPI_BYTE_OVERHEAD_CYCLES of driver code around each
+ *          byte (see spi_byte_cycles), and in delays. Other CPU time isn't
+ *          simulated, so calls that neither send nor wait measure 0
+ * @{
+ */
+
+#ifndef GLCD_PROFILER_H
+#define GLCD_PROFILER_H
+
+/********************************* Includes **********************************/
+#include "../HAL/HAL.h"
+
+/********************************** Macros ***********************************/
+// Define this to time the drawing calls. Without it, the profiler's hooks in
+// the driver compile to nothing and its functions are left out
+// #define GLCD_PROFILER
+
+#if defined(GLCD_PROFILER)
+/** @brief Marks the start of a timed call, in a local variable */
+#define PROFILE_BEGIN() unsigned long profileStart = halGetTickLong()
+
+/** @brief Marks the end of a timed call */
+#define PROFILE_END(primitive) glcdProfilerRecord((primitive), profileStart)
+#else
+#define PROFILE_BEGIN()
+#define PROFILE_END(primitive)
+#endif
+
+/********************************** Types ************************************/
+/** @brief The timed drawing calls */
+typedef enum{
+    PROF_DRAW_RECTANGLE, /**< glcdDrawRectangle */
+    PROF_DRAW_PIXEL,     /**< glcdDrawPixel */
+    PROF_SET_WINDOW,     /**< glcdSetWindow */
+    PROF_WRITE_PIXELS,   /**< glcdWritePixels */
+    PROF_BLIT,           /**< glcdBlit */
+    PROF_DRAW_CHAR,      /**< glcdDrawChar */
+    PROF_DRAW_STRING,    /**< glcdDrawString */
+    PROF_SET_ORIGIN,     /**< glcdSetOrigin */
+    PROF_SET_COLMOD,     /**< glcdSetCOLMOD */
+    PROF_NUM_PRIMITIVES
+}glcd_prof_primitive_e;
+
+/** @brief Timing of one kind of call */
+typedef struct{
+    unsigned long calls;
+    unsigned long minCycles;
+    unsigned long maxCycles;
+    unsigned long totalCycles; /**< Wraps after 2^32 cycles (~28 min) */
+}glcd_prof_stats_t;
+
+#if defined(GLCD_PROFILER)
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Adds a measurement. Called by PROFILE_END
+ * @param primitive The call that was timed
+ * @param start Tick when the call began
+ */
+void glcdProfilerRecord(glcd_prof_primitive_e primitive, unsigned long start);
+
+/**
+ * @brief Gets the timing of one kind of call
+ * @param primitive The call
+ * @param stats Where to put its statistics
+ */
+void glcdProfilerGet(glcd_prof_primitive_e primitive, glcd_prof_stats_t* stats);
+
+/** @brief Clears the statistics of every call */
+void glcdProfilerReset(void);
+
+/**
+ * @brief Sends the statistics over the EUSART (see halUartInit), one line
+ *        per call that was made at least once:
+ *        @code
+ *        name calls min max avg total
+ *        @endcode
+ *        with times in instruction cycles, after a header line
+ */
+void glcdProfilerReport(void);
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_PROFILER_H */
@@ -0,0 +1,387 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Queue
+ */
+
+/********************************* Includes **********************************/
+#include <string.h>
+#include "GLCD_Queue.h"
+#include "GLCD_Trace.h"
+#include "../SPI/SPI_PIC.h"
+
+/******************************** Constants **********************************/
+// Record opcodes. Each record is the opcode followed by its arguments
+static const unsigned char QOP_RECT = 1; /**< XS, XE, YS, YE, color (3) */
+static const unsigned char QOP_TEXT = 2; /**< x, y, fg (3), bg (3), len, chars */
+static const unsigned char QOP_BLIT = 3; /**< XS, XE, YS, YE, data pointer */
+
+static const unsigned char RECT_RECORD_SIZE = 8;
+static const unsigned char TEXT_RECORD_SIZE = 10; /**< Not including chars */
+#define BLIT_RECORD_SIZE (5 + sizeof(const unsigned char*))
+
+/***************************** Private Variables *****************************/
+static unsigned char buffers[2][QUEUE_BUFFER_SIZE];
+static unsigned char recordLen[2] = {0, 0};
+static unsigned char recording = 0; /**< Buffer the application records into */
+static volatile unsigned char busy = 0; /**< 1 while the interrupt is sending */
+
+// Expansion state, only used by the interrupt while busy
+static const unsigned char* sendBuf; /**< Buffer being sent */
+static unsigned char sendLen; /**< Length of the records in sendBuf */
+static unsigned char sendPos; /**< Next record in sendBuf */
+static unsigned char bpp; /**< Interface pixel format for this buffer */
+static unsigned char csMask; /**< Chip select bits of the display(s) */
+
+static unsigned char stage[GLCD_WINDOW_SETUP_BYTES]; /**< Bytes to send next */
+static unsigned char stageLen = 0;
+static unsigned char stagePos = 0;
+static unsigned char stageIsWindow = 0; /**< 1 if stage holds a window setup */
+
+static unsigned char currentOp; /**< Opcode of the record being expanded */
+static unsigned short pixelsLeft = 0; /**< Pixels left in a rect or text */
+static unsigned char fgData[3]; /**< Encoded foreground (or rect) color */
+static unsigned char bgData[3]; /**< Encoded background color */
+
+static const unsigned char* textChars; /**< Next character of a text record */
+static const unsigned char* glyph; /**< Glyph of the current character */
+static unsigned char glyphCol; /**< Column within the character cell */
+static unsigned char glyphRow; /**< Row within the character cell */
+
+static const unsigned char* blitData; /**< Next byte of a blit */
+static unsigned short blitLeft = 0; /**< Bytes left in a blit */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Reserves space in the recording buffer, submitting it first if it's
+ *        too full
+ * @param len Size of the record
+ * @return Pointer to the space for the record, or 0 if it's too large
+ */
+static unsigned char* queueReserve(unsigned char len){
+    if(len > QUEUE_BUFFER_SIZE){
+        return 0;
+    }
+    if(len > QUEUE_BUFFER_SIZE - recordLen[recording]){
+        glcdQueueSubmit(); // Back-pressure: waits for the other buffer
+    }
+    unsigned char* record = &buffers[recording][recordLen[recording]];
+    recordLen[recording] += len;
+    return record;
+}
+
+/**
+ * @brief Stores a color in a record
+ * @param dst Where to put the color (3 bytes)
+ * @param color The 24-bit color
+ */
+static void queuePutColor(unsigned char* dst, unsigned long color){
+    dst[0] = (color >> 16) & 0xFF;
+    dst[1] = (color >> 8) & 0xFF;
+    dst[2] = color & 0xFF;
+}
+
+/**
+ * @brief Reads a color from a record
+ * @param src The color (3 bytes)
+ * @return The 24-bit color
+ */
+static unsigned long queueGetColor(const unsigned char* src){
+    return ((unsigned long)src[0] << 16) | ((unsigned short)src[1] << 8) | src[2];
+}
+
+/**
+ * @brief Gets the encoded color of the next pixel of the current record
+ * @return fgData or bgData
+ */
+static const unsigned char* queueNextPixel(void){
+    pixelsLeft--;
+    if(currentOp != QOP_TEXT){
+        return fgData;
+    }
+    
+    // Text cells are filled a column at a time. The last column and the last
+    // row of each cell are spacing
+    unsigned char isFg = 0;
+    if(glyphCol < FONT_GLYPH_WIDTH){
+        isFg = (glyph[glyphCol] >> glyphRow) & 1;
+    }
+    if(++glyphRow == FONT_CHAR_HEIGHT){
+        glyphRow = 0;
+        if((++glyphCol == FONT_CHAR_WIDTH) && (pixelsLeft > 0)){
+            glyphCol = 0;
+            textChars++;
+            glyph = fontGetGlyph(*textChars);
+        }
+    }
+    return isFg ? fgData : bgData;
+}
+
+/** @brief Stages the bytes for the next pixel (or pair, at 12 bpp) */
+static void queueStagePixels(void){
+    const unsigned char* p1 = queueNextPixel();
+    stageIsWindow = 0;
+    stagePos = 0;
+    
+    if(bpp == 12){
+        stage[0] = p1[0] | (p1[1] >> 4);
+        if(pixelsLeft == 0){
+            // Odd pixel out: it is complete after 1.5 bytes
+            stage[1] = p1[2];
+            stageLen = 2;
+        }
+        else{
+            const unsigned char* p2 = queueNextPixel();
+            stage[1] = p1[2] | (p2[0] >> 4);
+            stage[2] = p2[1] | (p2[2] >> 4);
+            stageLen = 3;
+        }
+    }
+    else{
+        stage[0] = p1[0];
+        stage[1] = p1[1];
+        stage[2] = p1[2];
+        stageLen = (bpp == 16) ? 2 : 3;
+    }
+}
+
+/**
+ * @brief Starts expanding the next record in the buffer being sent, by
+ *        staging its window setup
+ * @return 0 if there are no more records, otherwise 1
+ */
+static unsigned char queueStartRecord(void){
+    if(sendPos >= sendLen){
+        return 0;
+    }
+    
+    const unsigned char* record = &sendBuf[sendPos];
+    currentOp = record[0];
+    unsigned char XS = record[1];
+    unsigned char XE;
+    unsigned char YS;
+    unsigned char YE;
+    
+    if(currentOp == QOP_TEXT){
+        unsigned char len = record[9];
+        XE = XS + len * FONT_CHAR_WIDTH;
+        YS = record[2];
+        YE = YS + FONT_CHAR_HEIGHT;
+        glcdEncodeColorAs(queueGetColor(&record[3]), bpp, fgData);
+        glcdEncodeColorAs(queueGetColor(&record[6]), bpp, bgData);
+        textChars = &record[10];
+        glyph = fontGetGlyph(*textChars);
+        glyphCol = 0;
+        glyphRow = 0;
+        pixelsLeft = (unsigned short)len * (FONT_CHAR_WIDTH * FONT_CHAR_HEIGHT);
+        sendPos += TEXT_RECORD_SIZE + len;
+    }
+    else{
+        XE = record[2];
+        YS = record[3];
+        YE = record[4];
+        unsigned short numPixels = (XE - XS) * (YE - YS);
+        if(currentOp == QOP_BLIT){
+            memcpy(&blitData, &record[5], sizeof(blitData));
+            if(bpp == 12){
+                blitLeft = numPixels + ((numPixels + 1) >> 1);
+            }
+            else{
+                blitLeft = numPixels * ((bpp == 16) ? 2 : 3);
+            }
+            sendPos += BLIT_RECORD_SIZE;
+        }
+        else{
+            glcdEncodeColorAs(queueGetColor(&record[5]), bpp, fgData);
+            pixelsLeft = numPixels;
+            sendPos += RECT_RECORD_SIZE;
+        }
+    }
+    
+    glcdEncodeWindow(XS, XE, YS, YE, stage);
+    stageLen = GLCD_WINDOW_SETUP_BYTES;
+    stagePos = 0;
+    stageIsWindow = 1;
+    return 1;
+}
+
+/**
+ * @brief Produces the next byte to send
+ * @param byte The byte
+ * @param isCmd 1 if the byte is a command, 0 if data
+ * @return 0 when the buffer has been sent, otherwise 1
+ */
+static unsigned char queueNextByte(unsigned char* byte, unsigned char* isCmd){
+    while(stagePos >= stageLen){
+        if(pixelsLeft > 0){
+            queueStagePixels();
+        }
+        else if(blitLeft > 0){
+            stageLen = (blitLeft < 3) ? blitLeft : 3;
+            for(unsigned char i = 0; i < stageLen; i++){
+                stage[i] = *blitData++;
+            }
+            blitLeft -= stageLen;
+            stagePos = 0;
+            stageIsWindow = 0;
+        }
+        else if(!queueStartRecord()){
+            return 0;
+        }
+    }
+
+    *isCmd = stageIsWindow ? GLCD_WINDOW_IS_CMD(stagePos) : 0;
+    *byte = stage[stagePos++];
+    return 1;
+}
+
+/***************************** Public Functions ******************************/
+void glcdQueueRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+)
+{
+    if((XE <= XS) || (YE <= YS)){
+        return;
+    }
+    
+    unsigned char* record = queueReserve(RECT_RECORD_SIZE);
+    if(record == 0){
+        return;
+    }
+    record[0] = QOP_RECT;
+    record[1] = XS;
+    record[2] = XE;
+    record[3] = YS;
+    record[4] = YE;
+    queuePutColor(&record[5], color);
+}
+
+void glcdQueueBlit(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    const unsigned char* data
+)
+{
+    if((XE <= XS) || (YE <= YS)){
+        return;
+    }
+    
+    unsigned char* record = queueReserve(BLIT_RECORD_SIZE);
+    if(record == 0){
+        return;
+    }
+    record[0] = QOP_BLIT;
+    record[1] = XS;
+    record[2] = XE;
+    record[3] = YS;
+    record[4] = YE;
+    memcpy(&record[5], &data, sizeof(data));
+}
+
+void glcdQueueText(
+    unsigned char x,
+    unsigned char y,
+    const char* str,
+    unsigned long fg,
+    unsigned long bg
+)
+{
+    // Count the characters that fit on the display, and in the buffer
+    unsigned char len = 0;
+    while((str[len] != '\0') &&
+          (x + (len + 1) * FONT_CHAR_WIDTH <= GLCD_SIZE_HORZ) &&
+          (len < QUEUE_BUFFER_SIZE - TEXT_RECORD_SIZE)){
+        len++;
+    }
+    if(len == 0){
+        return;
+    }
+    
+    unsigned char* record = queueReserve(TEXT_RECORD_SIZE + len);
+    if(record == 0){
+        return;
+    }
+    record[0] = QOP_TEXT;
+    record[1] = x;
+    record[2] = y;
+    queuePutColor(&record[3], fg);
+    queuePutColor(&record[6], bg);
+    record[9] = len;
+    memcpy(&record[10], str, len);
+}
+
+void glcdQueueSubmit(void){
+    if(recordLen[recording] == 0){
+        return;
+    }
+    
+    while(busy){
+        halPoll();
+    }
+    
+    // Hand the recorded buffer to the interrupt, and switch to the other one
+    sendBuf = buffers[recording];
+    sendLen = recordLen[recording];
+    sendPos = 0;
+    stageLen = 0;
+    stagePos = 0;
+    pixelsLeft = 0;
+    blitLeft = 0;
+    bpp = glcdGetCOLMOD();
+    csMask = glcdGetSelectMask();
+    recording ^= 1;
+    recordLen[recording] = 0;
+    
+    // Send the first byte here. The rest are sent by the interrupt, which
+    // keeps the display selected until the buffer has been sent
+    unsigned char byte, isCmd;
+    if(queueNextByte(&byte, &isCmd)){
+        busy = 1;
+        LAT_CS_GLCD &= ~csMask;
+        RS_GLCD = isCmd ? 0 : 1;
+        spiFinishTransfer(); // Clear any stale flags
+        mssp_int_enable();
+        TRACE_BYTE(byte, isCmd);
+        spiStartSend(byte);
+    }
+}
+
+void glcdQueueFence(void){
+    glcdQueueSubmit();
+    while(busy){
+        halPoll();
+    }
+}
+
+unsigned char glcdQueueIsBusy(void){
+    return busy;
+}
+
+unsigned char glcdQueueGetFreeSpace(void){
+    return QUEUE_BUFFER_SIZE - recordLen[recording];
+}
+
+void glcdQueueServiceISR(void){
+    spiFinishTransfer();
+    
+    unsigned char byte, isCmd;
+    if(queueNextByte(&byte, &isCmd)){
+        RS_GLCD = isCmd ? 0 : 1;
+        TRACE_BYTE(byte, isCmd);
+        spiStartSend(byte);
+    }
+    else{
+        // Done with this buffer
+        mssp_int_disable();
+        LAT_CS_GLCD |= csMask;
+        busy = 0;
+    }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Queue
+ * @brief Double-buffered display command queue, sent from the MSSP interrupt
+ * @details Drawing commands are recorded into one buffer while the other is
+ *          expanded into bytes and sent one byte per MSSP interrupt, so the
+ *          application can build the next frame while the current one is
+ *          still going out. Commands are stored compactly (e.g. 8 bytes for a
+ *          rectangle of any size) and only expanded into pixel data as they
+ *          are sent.
+ *
+ *          The application's interrupt service routine must call
+ *          glcdQueueServiceISR when mssp_int_pending() is true, and GIE and
+ *          PEIE must be set. While the queue is sending, nothing else may use
+ *          the SPI bus, so call glcdQueueFence before using the blocking
+ *          drawing functions or another SPI device.
+ *
+ *          The interrupt overhead is larger than the time it takes to send a
+ *          byte at FOSC / 4, so the queue frees up the most CPU time at the
+ *          slower SPI clocks
+ * @{
+ */
+
+#ifndef GLCD_QUEUE_H
+#define GLCD_QUEUE_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+#include "GLCD_Font.h"
+
+/********************************** Macros ***********************************/
+/** @brief Size of each of the two command buffers, in bytes (max: 255) */
+#define QUEUE_BUFFER_SIZE 96
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Records a solid rectangle (see glcdDrawRectangle)
+ * @note Blocks if the recording buffer is full and the other buffer is still
+ *       being sent
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param color Color of the rectangle
+ */
+void glcdQueueRect(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    unsigned long color
+);
+
+/**
+ * @brief Records an image to be copied into a window
+ * @note Blocks if the recording buffer is full and the other buffer is still
+ *       being sent
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param data The pixels, already encoded in the interface pixel format that
+ *        will be in effect when they are sent, in the order the window is
+ *        filled (see glcdSetWindow). Only the pointer is recorded, so the data
+ *        must not change until the queue has sent it
+ */
+void glcdQueueBlit(
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    const unsigned char* data
+);
+
+/**
+ * @brief Records a string of text on a single line (see glcdDrawString). The
+ *        characters are copied into the queue
+ * @note Blocks if the recording buffer is full and the other buffer is still
+ *       being sent. Strings that don't fit into an empty buffer are cut off
+ * @param x x-position of the first character cell
+ * @param y y-position of the first character cell
+ * @param str The null-terminated string
+ * @param fg Color of the characters
+ * @param bg Color of the rest of the cells
+ */
+void glcdQueueText(
+    unsigned char x,
+    unsigned char y,
+    const char* str,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @brief Hands the recorded commands to the interrupt to be sent, and starts
+ *        recording into the other buffer
+ * @note Blocks until the other buffer is done being sent
+ */
+void glcdQueueSubmit(void);
+
+/**
+ * @brief Submits the recorded commands, and waits until everything has been
+ *        sent. Afterwards, the SPI bus is free
+ */
+void glcdQueueFence(void);
+
+/**
+ * @brief Checks whether the interrupt is still sending commands
+ * @return 1 if busy, 0 if idle
+ */
+unsigned char glcdQueueIsBusy(void);
+
+/**
+ * @brief Gets the free space in the recording buffer
+ * @return Free bytes (a rectangle needs 8, text needs 10 plus its length)
+ */
+unsigned char glcdQueueGetFreeSpace(void);
+
+/**
+ * @brief Sends the next byte of the queue. Must be called from the interrupt
+ *        service routine when mssp_int_pending() is true
+ */
+void glcdQueueServiceISR(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_QUEUE_H */
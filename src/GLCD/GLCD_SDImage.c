@@ -0,0 +1,164 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_SDImage
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_SDImage.h"
+
+/******************************** Constants **********************************/
+static const unsigned char MAGIC_0 = 'G';
+static const unsigned char MAGIC_1 = 'I';
+
+static const unsigned char RLE_RECORD_SIZE = 3; /**< Count, then 2 bytes */
+
+/********************************** Types ************************************/
+/** @brief Progress through an image's pixel data */
+typedef struct{
+    glcd_sdimage_format_e format;
+    unsigned long remaining; /**< Bytes (raw) or pixels (RLE) left to send */
+    unsigned char record[3]; /**< RLE record split across chunks */
+    unsigned char recordBytes; /**< Bytes of it received so far */
+}sdimage_stream_t;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Converts a color from the way it's sent at 16 bpp back to 24 bits
+ *        (see glcdEncodeColor)
+ * @param data The 2 bytes
+ * @return 24-bit color, which glcdEncodeColor turns back into the same bytes
+ */
+static unsigned long sdImageDecodeColor(const unsigned char* data){
+    unsigned char blue = data[0] & 0xF8;
+    unsigned char green = ((data[0] & 0x07) << 5) | ((data[1] & 0xE0) >> 3);
+    unsigned char red = (data[1] & 0x1F) << 3;
+    return ((unsigned long)red << 16) | ((unsigned short)green << 8) | blue;
+}
+
+/**
+ * @brief Sends the pixel data in a chunk to the drawing window
+ * @param stream Progress through the image
+ * @param data The chunk's data
+ * @param numBytes Bytes in the chunk. Any after the end of the image are
+ *        ignored
+ * @return 0 if the data isn't valid, otherwise 1
+ */
+static unsigned char sdImageSendChunk(
+    sdimage_stream_t* stream,
+    const unsigned char* data,
+    unsigned short numBytes
+)
+{
+    // Raw pixels are already in the interface pixel format
+    if(stream->format != SDIMAGE_RLE16){
+        if(numBytes > stream->remaining){
+            numBytes = stream->remaining;
+        }
+        glcdWriteData(data, numBytes);
+        stream->remaining -= numBytes;
+        return 1;
+    }
+    
+    for(unsigned short i = 0; (i < numBytes) && (stream->remaining > 0); i++){
+        stream->record[stream->recordBytes++] = data[i];
+        if(stream->recordBytes < RLE_RECORD_SIZE){
+            continue;
+        }
+        stream->recordBytes = 0;
+        
+        // A run can't go past the end of the window, or it would wrap around
+        // to the start
+        unsigned short count = stream->record[0];
+        if(count == 0){
+            return 0;
+        }
+        if(count > stream->remaining){
+            count = stream->remaining;
+        }
+        glcdWritePixels(sdImageDecodeColor(&stream->record[1]), count);
+        stream->remaining -= count;
+    }
+    return 1;
+}
+
+/***************************** Public Functions ******************************/
+unsigned char glcdDrawSDImage(
+    unsigned char x,
+    unsigned char y,
+    unsigned long sector,
+    unsigned char* buf,
+    unsigned char numSectors
+)
+{
+    if((numSectors == 0) || (numSectors > SDIMAGE_MAX_SECTORS)){
+        return 0;
+    }
+    
+    // The bus is at the display's clock when called. The card's clock is
+    // selected by sdReadSectors, and the display's is put back after each
+    // read (neither does anything when the two are the same)
+    unsigned char glcdDivider = spiGetDivider();
+    unsigned char success = sdReadSectors(sector, numSectors, buf);
+    spiSetDivider(glcdDivider);
+    if(!success){
+        return 0;
+    }
+    
+    if((buf[0] != MAGIC_0) || (buf[1] != MAGIC_1) || (buf[2] > SDIMAGE_RLE16)){
+        return 0;
+    }
+    unsigned char width = buf[3];
+    unsigned char height = buf[4];
+    if((width == 0) || (height == 0) ||
+       ((unsigned short)x + width > GLCD_SIZE_HORZ) ||
+       ((unsigned short)y + height > GLCD_SIZE_VERT))
+    {
+        return 0;
+    }
+    
+    sdimage_stream_t stream;
+    stream.format = buf[2];
+    stream.remaining = (unsigned long)width * height;
+    if(stream.format == SDIMAGE_RAW16){
+        stream.remaining *= 2;
+    }
+    else if(stream.format == SDIMAGE_RAW18){
+        stream.remaining *= 3;
+    }
+    stream.recordBytes = 0;
+    
+    // Send the data in the depth it's stored in. The COLMOD command has to go
+    // out before the window, since any command ends the memory write
+    unsigned char bpp = glcdGetCOLMOD();
+    glcdSetCOLMOD((stream.format == SDIMAGE_RAW18) ? 18 : 16);
+    
+    if(glcdSetWindow(x, x + width, y, y + height)){
+        // Multiplying as an int would overflow at 64 sectors with XC8
+        unsigned short chunkBytes =
+            (unsigned short)numSectors * SD_SECTOR_SIZE;
+        const unsigned char* data = buf + SDIMAGE_HEADER_SIZE;
+        unsigned short numBytes = chunkBytes - SDIMAGE_HEADER_SIZE;
+        for(;;){
+            success = sdImageSendChunk(&stream, data, numBytes);
+            glcdEndPixels(); // Deselects the display before the card is used
+            if(!success || (stream.remaining == 0)){
+                break;
+            }
+            
+            sector += numSectors;
+            success = sdReadSectors(sector, numSectors, buf);
+            spiSetDivider(glcdDivider);
+            if(!success){
+                break;
+            }
+            data = buf;
+            numBytes = chunkBytes;
+        }
+    }
+    
+    glcdSetCOLMOD(bpp);
+    return success;
+}
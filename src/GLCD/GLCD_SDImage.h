@@ -0,0 +1,92 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_SDImage
+ * @brief Draws images stored on an SD card that shares the SPI bus
+ * @details Images too big for flash are streamed from the card: a chunk of
+ *          sectors is read into a buffer in RAM with the display deselected,
+ *          then sent on to the display with the card deselected, and so on.
+ *          The window is set once; the controller keeps filling it across
+ *          chip select changes, as long as no command is sent. The bus
+ *          switches between devices twice per chunk, and the clock only
+ *          changes when the card and the display don't use the same divider,
+ *          so a bigger buffer means fewer switches.
+ *
+ *          An image starts at the beginning of a sector with an
+ *          SDIMAGE_HEADER_SIZE byte header, and its pixel data follows
+ *          immediately, continuing into the sectors after it:
+ *          @code
+ *          Byte 0-1   'G', 'I'
+ *          Byte 2     Format (glcd_sdimage_format_e)
+ *          Byte 3     Width (along x)
+ *          Byte 4     Height (along y)
+ *          Byte 5-7   0
+ *          @endcode
+ *          Pixels are stored in the order a window is filled (see
+ *          glcdSetWindow). The raw formats hold them as glcdBlit takes them
+ *          at 16 or 18 bpp, and are sent as they are. SDIMAGE_RLE16 holds
+ *          runs of one color as 3 bytes: the number of pixels (1 to 255)
+ *          followed by the color as it's sent at 16 bpp, and runs may
+ *          continue from one column to the next.
+ *
+ *          The interface pixel format is set to that of the image while it's
+ *          drawn, and restored afterwards
+ * @{
+ */
+
+#ifndef GLCD_SDIMAGE_H
+#define GLCD_SDIMAGE_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+#include "../SD/SD_PIC.h"
+
+/********************************** Macros ***********************************/
+/** @brief Bytes before the pixel data */
+#define SDIMAGE_HEADER_SIZE 8
+
+/**
+ * @brief Most sectors glcdDrawSDImage reads at a time, so that a chunk's size
+ *        in bytes fits in an unsigned short
+ */
+#define SDIMAGE_MAX_SECTORS 127
+
+/********************************** Types ************************************/
+/** @brief How the pixels of an image are stored */
+typedef enum{
+    SDIMAGE_RAW16, /**< 2 bytes per pixel, as sent at 16 bpp */
+    SDIMAGE_RAW18, /**< 3 bytes per pixel, as sent at 18 bpp */
+    SDIMAGE_RLE16  /**< Runs of 16 bpp colors */
+}glcd_sdimage_format_e;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Draws an image stored on the SD card (see sdInit)
+ * @note The display must not be in a transaction (glcdBeginTransaction), and
+ *       the queue must be idle, since the display has to be deselected while
+ *       the card is read
+ * @param x x-position of the image's first column
+ * @param y y-position of the image's first row
+ * @param sector Sector the image starts at
+ * @param buf Buffer for the chunks (numSectors * SD_SECTOR_SIZE bytes)
+ * @param numSectors Sectors read at a time (min: 1, max:
+ *        SDIMAGE_MAX_SECTORS)
+ * @return 0 if numSectors is out of range, or the image couldn't be read,
+ *         isn't valid, or doesn't fit on the display, otherwise 1. A read
+ *         error part way through leaves the image partly drawn
+ */
+unsigned char glcdDrawSDImage(
+    unsigned char x,
+    unsigned char y,
+    unsigned long sector,
+    unsigned char* buf,
+    unsigned char numSectors
+);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_SDIMAGE_H */
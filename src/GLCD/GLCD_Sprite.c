@@ -0,0 +1,205 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Sprite
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Sprite.h"
+
+/********************************** Types ************************************/
+/** @brief A rectangle on screen */
+typedef struct{
+    unsigned char XS;
+    unsigned char XE;
+    unsigned char YS;
+    unsigned char YE;
+}sprite_rect_t;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Gets the area a sprite covers at a position, clipped to the screen
+ * @param image The sprite's image
+ * @param x x-position
+ * @param y y-position
+ * @param rect The area
+ */
+static void spriteBounds(
+    const sprite_image_t* image,
+    unsigned char x,
+    unsigned char y,
+    sprite_rect_t* rect
+)
+{
+    unsigned short XE = (unsigned short)x + image->width;
+    unsigned short YE = (unsigned short)y + image->height;
+    rect->XS = x;
+    rect->YS = y;
+    rect->XE = (XE < GLCD_SIZE_HORZ) ? XE : GLCD_SIZE_HORZ;
+    rect->YE = (YE < GLCD_SIZE_VERT) ? YE : GLCD_SIZE_VERT;
+}
+
+/**
+ * @brief Computes how many bytes it takes to fill a window
+ * @param rect The window
+ * @return Window setup plus pixel data, in the current pixel format
+ */
+static unsigned short spriteCost(const sprite_rect_t* rect){
+    if((rect->XE <= rect->XS) || (rect->YE <= rect->YS)){
+        return 0;
+    }
+    unsigned short numPixels = (rect->XE - rect->XS) * (rect->YE - rect->YS);
+    switch(glcdGetCOLMOD()){
+        case 12:
+            numPixels += (numPixels + 1) >> 1;
+            break;
+        case 16:
+            numPixels *= 2;
+            break;
+        default:
+            numPixels *= 3;
+            break;
+    }
+    return GLCD_WINDOW_SETUP_BYTES + numPixels;
+}
+
+/**
+ * @brief Draws a rectangle of the screen: the sprite's image where it is
+ *        visible and opaque, and the background everywhere else
+ * @param sprite The sprite
+ * @param rect The rectangle
+ * @return Bytes sent to the display
+ */
+static unsigned short spriteDrawArea(
+    const glcd_sprite_t* sprite,
+    const sprite_rect_t* rect
+)
+{
+    unsigned short cost = spriteCost(rect);
+    if((cost == 0) ||
+       !glcdSetWindow(rect->XS, rect->XE, rect->YS, rect->YE)){
+        return 0;
+    }
+    
+    const sprite_image_t* image = sprite->image;
+    unsigned long runColor = 0;
+    unsigned short runLength = 0;
+    for(unsigned char x = rect->XS; x < rect->XE; x++){
+        for(unsigned char y = rect->YS; y < rect->YE; y++){
+            unsigned char index = image->transparent;
+            if(sprite->visible &&
+               (x >= sprite->x) && (x - sprite->x < image->width) &&
+               (y >= sprite->y) && (y - sprite->y < image->height)){
+                index = image->pixels[
+                    (unsigned short)(x - sprite->x) * image->height +
+                    (y - sprite->y)
+                ];
+            }
+            
+            unsigned long color;
+            if(index != image->transparent){
+                color = image->palette[index];
+            }
+            else if(sprite->background != 0){
+                color = sprite->background(x, y);
+            }
+            else{
+                color = sprite->bgColor;
+            }
+            
+            if((runLength > 0) && (color != runColor)){
+                glcdWritePixels(runColor, runLength);
+                runLength = 0;
+            }
+            runColor = color;
+            runLength++;
+        }
+    }
+    glcdWritePixels(runColor, runLength);
+    glcdEndPixels();
+    return cost;
+}
+
+/**
+ * @brief Redraws the areas a sprite covered before and covers now
+ * @param sprite The sprite, already at its new position
+ * @param old The area it covered before
+ * @param now The area it covers now
+ * @return Bytes sent to the display
+ */
+static unsigned short spriteUpdate(
+    const glcd_sprite_t* sprite,
+    const sprite_rect_t* old,
+    const sprite_rect_t* now
+)
+{
+    sprite_rect_t both;
+    both.XS = (old->XS < now->XS) ? old->XS : now->XS;
+    both.XE = (old->XE > now->XE) ? old->XE : now->XE;
+    both.YS = (old->YS < now->YS) ? old->YS : now->YS;
+    both.YE = (old->YE > now->YE) ? old->YE : now->YE;
+    
+    // One window around both unless that sends more than two separate ones,
+    // which can only be the case when they don't overlap
+    unsigned char overlap = (old->XS < now->XE) && (now->XS < old->XE) &&
+                            (old->YS < now->YE) && (now->YS < old->YE);
+    if(overlap ||
+       (spriteCost(&both) <= spriteCost(old) + spriteCost(now))){
+        return spriteDrawArea(sprite, &both);
+    }
+    return spriteDrawArea(sprite, old) + spriteDrawArea(sprite, now);
+}
+
+/***************************** Public Functions ******************************/
+void glcdSpriteInit(
+    glcd_sprite_t* sprite,
+    const sprite_image_t* image,
+    sprite_bg_fn_t background,
+    unsigned long bgColor
+)
+{
+    sprite->image = image;
+    sprite->background = background;
+    sprite->bgColor = bgColor;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->visible = 0;
+}
+
+unsigned short glcdSpriteMove(
+    glcd_sprite_t* sprite,
+    unsigned char x,
+    unsigned char y
+)
+{
+    sprite_rect_t old, now;
+    spriteBounds(sprite->image, x, y, &now);
+    
+    if(!sprite->visible){
+        sprite->x = x;
+        sprite->y = y;
+        sprite->visible = 1;
+        return spriteDrawArea(sprite, &now);
+    }
+    if((x == sprite->x) && (y == sprite->y)){
+        return 0;
+    }
+    
+    spriteBounds(sprite->image, sprite->x, sprite->y, &old);
+    sprite->x = x;
+    sprite->y = y;
+    return spriteUpdate(sprite, &old, &now);
+}
+
+unsigned short glcdSpriteHide(glcd_sprite_t* sprite){
+    if(!sprite->visible){
+        return 0;
+    }
+    
+    sprite_rect_t old;
+    spriteBounds(sprite->image, sprite->x, sprite->y, &old);
+    sprite->visible = 0;
+    return spriteDrawArea(sprite, &old);
+}
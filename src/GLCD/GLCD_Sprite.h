@@ -0,0 +1,94 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Sprite
+ * @brief Small images that move over a background
+ * @details The display RAM can't be read back, so whatever a sprite covered
+ *          has to be redrawn when it moves. Each sprite either has a
+ *          background callback that gives the color of any background pixel,
+ *          or a solid background color. A move sends the old and new
+ *          positions together as one window covering both when they overlap,
+ *          or as two windows when that's fewer bytes. Pixels of the image in
+ *          the sprite's transparent color show the background.
+ *
+ *          Sprites must not overlap each other
+ * @{
+ */
+
+#ifndef GLCD_SPRITE_H
+#define GLCD_SPRITE_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Types ************************************/
+/**
+ * @brief Gives the color of the background at a pixel
+ * @param x x-position of the pixel
+ * @param y y-position of the pixel
+ * @return 24-bit color
+ */
+typedef unsigned long (*sprite_bg_fn_t)(unsigned char x, unsigned char y);
+
+/** @brief An image stored in ROM */
+typedef struct{
+    const unsigned char* pixels;  /**< Palette index of each pixel, a column
+                                       at a time (see glcdSetWindow) */
+    const unsigned long* palette; /**< 24-bit colors */
+    unsigned char width;          /**< Pixels along the x-axis */
+    unsigned char height;         /**< Pixels along the y-axis */
+    unsigned char transparent;    /**< Palette index that shows background */
+}sprite_image_t;
+
+/** @brief A sprite. Its fields are managed by the functions below */
+typedef struct{
+    const sprite_image_t* image;
+    sprite_bg_fn_t background; /**< 0 to use bgColor */
+    unsigned long bgColor;
+    unsigned char x;
+    unsigned char y;
+    unsigned char visible;
+}glcd_sprite_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets up a sprite. It starts out hidden
+ * @param sprite The sprite
+ * @param image Its image
+ * @param background Background callback, or 0 for a solid background
+ * @param bgColor Background color, if there's no callback
+ */
+void glcdSpriteInit(
+    glcd_sprite_t* sprite,
+    const sprite_image_t* image,
+    sprite_bg_fn_t background,
+    unsigned long bgColor
+);
+
+/**
+ * @brief Moves a sprite, showing it if it was hidden
+ * @param sprite The sprite
+ * @param x New x-position of the image's first column
+ * @param y New y-position of the image's first row
+ * @return Bytes sent to the display
+ */
+unsigned short glcdSpriteMove(
+    glcd_sprite_t* sprite,
+    unsigned char x,
+    unsigned char y
+);
+
+/**
+ * @brief Hides a sprite, restoring the background underneath it
+ * @param sprite The sprite
+ * @return Bytes sent to the display
+ */
+unsigned short glcdSpriteHide(glcd_sprite_t* sprite);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_SPRITE_H */
@@ -0,0 +1,133 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_TileMap
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_TileMap.h"
+
+/***************************** Private Variables *****************************/
+static const tilemap_tileset_t* tiles = 0;
+static unsigned char map[TILEMAP_ROWS][TILEMAP_COLS];
+
+// Pixels of the same color are collected into runs and written together
+static unsigned long runColor;
+static unsigned short runLength = 0;
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Adds a pixel to the current run, writing the run out if the color
+ *        changed
+ * @param color The pixel's color
+ */
+static void tilemapPutPixel(unsigned long color){
+    if((runLength > 0) && (color != runColor)){
+        glcdWritePixels(runColor, runLength);
+        runLength = 0;
+    }
+    runColor = color;
+    runLength++;
+}
+
+/** @brief Writes out the current run */
+static void tilemapFlushRun(void){
+    if(runLength > 0){
+        glcdWritePixels(runColor, runLength);
+        runLength = 0;
+    }
+}
+
+/**
+ * @brief Sends the pixels of a tile to the open drawing window
+ * @param tile Tile index
+ */
+static void tilemapWriteTile(unsigned char tile){
+    if(tile >= tiles->numTiles){
+        tile = 0;
+    }
+    const unsigned char* p = &tiles->pixels[tile * TILEMAP_TILE_BYTES];
+    const unsigned long* palette = tiles->palettes[tiles->paletteOf[tile]];
+    
+    for(unsigned char i = 0; i < TILEMAP_TILE_BYTES; i++){
+        unsigned char bits = p[i];
+        for(unsigned char j = 0; j < 4; j++){
+            tilemapPutPixel(palette[bits & 3]);
+            bits >>= 2;
+        }
+    }
+}
+
+/***************************** Public Functions ******************************/
+void glcdTileMapInit(const tilemap_tileset_t* tileset){
+    tiles = tileset;
+    for(unsigned char row = 0; row < TILEMAP_ROWS; row++){
+        for(unsigned char col = 0; col < TILEMAP_COLS; col++){
+            map[row][col] = 0;
+        }
+    }
+}
+
+void glcdTileMapSet(unsigned char col, unsigned char row, unsigned char tile){
+    if((col >= TILEMAP_COLS) || (row >= TILEMAP_ROWS) ||
+       (map[row][col] == tile)){
+        return;
+    }
+    map[row][col] = tile;
+    glcdTileMapDrawCells(col, 1, row, 1);
+}
+
+void glcdTileMapPut(unsigned char col, unsigned char row, unsigned char tile){
+    if((col < TILEMAP_COLS) && (row < TILEMAP_ROWS)){
+        map[row][col] = tile;
+    }
+}
+
+unsigned char glcdTileMapGet(unsigned char col, unsigned char row){
+    if((col >= TILEMAP_COLS) || (row >= TILEMAP_ROWS)){
+        return 0;
+    }
+    return map[row][col];
+}
+
+void glcdTileMapDrawCells(
+    unsigned char col,
+    unsigned char cols,
+    unsigned char row,
+    unsigned char rows
+)
+{
+    if((tiles == 0) || (col >= TILEMAP_COLS) || (row >= TILEMAP_ROWS)){
+        return;
+    }
+    if(cols > TILEMAP_COLS - col){
+        cols = TILEMAP_COLS - col;
+    }
+    if(rows > TILEMAP_ROWS - row){
+        rows = TILEMAP_ROWS - row;
+    }
+    
+    // The window is filled a column at a time, so a window one tile tall
+    // takes the tiles of a row one after another
+    for(unsigned char r = row; r < row + rows; r++){
+        unsigned char YS = r * TILEMAP_TILE_SIZE;
+        if(!glcdSetWindow(
+                col * TILEMAP_TILE_SIZE,
+                (col + cols) * TILEMAP_TILE_SIZE,
+                YS,
+                YS + TILEMAP_TILE_SIZE)){
+            continue;
+        }
+        for(unsigned char c = col; c < col + cols; c++){
+            tilemapWriteTile(map[r][c]);
+        }
+        tilemapFlushRun();
+        glcdEndPixels();
+    }
+}
+
+void glcdTileMapDraw(void){
+    glcdTileMapDrawCells(0, TILEMAP_COLS, 0, TILEMAP_ROWS);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_TileMap
+ * @brief Background made up of 8 x 8 pixel tiles
+ * @details The tiles are stored once in ROM at 2 bits per pixel, each with
+ *          one of several 4-color palettes. The screen is described by a map
+ *          of tile indices in RAM (TILEMAP_COLS x TILEMAP_ROWS bytes).
+ *
+ *          Tile pixels are stored a column at a time, in the order a window
+ *          is filled (see glcdSetWindow): 2 bytes per column, with the top 4
+ *          pixels in the first byte and the top pixel of each byte in its
+ *          two least significant bits
+ * @{
+ */
+
+#ifndef GLCD_TILEMAP_H
+#define GLCD_TILEMAP_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+
+/********************************** Macros ***********************************/
+#define TILEMAP_TILE_SIZE 8  /**< Width and height of a tile, in pixels */
+#define TILEMAP_TILE_BYTES 16 /**< ROM used by each tile's pixels */
+#define TILEMAP_PALETTE_COLORS 4 /**< Colors in each tile palette */
+#define TILEMAP_COLS 16 /**< Map cells along the x-axis */
+#define TILEMAP_ROWS 16 /**< Map cells along the y-axis */
+
+/********************************** Types ************************************/
+/** @brief A set of tiles stored in ROM */
+typedef struct{
+    const unsigned char* pixels;   /**< TILEMAP_TILE_BYTES per tile */
+    const unsigned char* paletteOf; /**< Palette number of each tile */
+    const unsigned long (*palettes)[TILEMAP_PALETTE_COLORS]; /**< Palettes */
+    unsigned char numTiles;        /**< Number of tiles in the set */
+}tilemap_tileset_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets the tiles the map refers to, and fills the map with tile 0.
+ *        Nothing is drawn
+ * @param tileset The tiles. Must stay valid while the map is in use
+ */
+void glcdTileMapInit(const tilemap_tileset_t* tileset);
+
+/**
+ * @brief Changes a map cell, and redraws it if the tile changed
+ * @param col Cell along the x-axis
+ * @param row Cell along the y-axis
+ * @param tile Tile index
+ */
+void glcdTileMapSet(unsigned char col, unsigned char row, unsigned char tile);
+
+/**
+ * @brief Changes a map cell without drawing it
+ * @param col Cell along the x-axis
+ * @param row Cell along the y-axis
+ * @param tile Tile index
+ */
+void glcdTileMapPut(unsigned char col, unsigned char row, unsigned char tile);
+
+/**
+ * @brief Gets the tile in a map cell
+ * @param col Cell along the x-axis
+ * @param row Cell along the y-axis
+ * @return Tile index
+ */
+unsigned char glcdTileMapGet(unsigned char col, unsigned char row);
+
+/**
+ * @brief Redraws a rectangle of map cells. Each row of cells is drawn in a
+ *        single window
+ * @param col First cell along the x-axis
+ * @param cols Number of cells along the x-axis
+ * @param row First cell along the y-axis
+ * @param rows Number of cells along the y-axis
+ */
+void glcdTileMapDrawCells(
+    unsigned char col,
+    unsigned char cols,
+    unsigned char row,
+    unsigned char rows
+);
+
+/** @brief Redraws the whole map, one window per row of cells */
+void glcdTileMapDraw(void);
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_TILEMAP_H */
@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Trace
+ */
+
+/********************************* Includes **********************************/
+#include "GLCD_Trace.h"
+#include "../SPI/SPI_PIC.h"
+
+#if defined(GLCD_TRACE)
+
+/******************************** Constants **********************************/
+// Kinds of record
+static const unsigned char TRACE_KIND_CMD = 'C';
+static const unsigned char TRACE_KIND_DATA = 'D';
+static const unsigned char TRACE_KIND_FRAME = 'F';
+
+static const unsigned char NO_RECORD = 0xFF;
+
+/********************************** Types ************************************/
+/** @brief A trace record */
+typedef struct{
+    unsigned char kind;
+    unsigned char cmd;
+    unsigned char params[TRACE_PARAMS];
+    unsigned short count; /**< Bytes after the command, up to 65535 */
+}trace_record_t;
+
+/***************************** Private Variables *****************************/
+static trace_record_t records[TRACE_RECORDS];
+static unsigned char next = 0; /**< Where the next record goes */
+static unsigned char numRecords = 0;
+static unsigned short dropped = 0; /**< Records overwritten, up to 65535 */
+static unsigned char current = NO_RECORD; /**< Record data is added to */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Starts a new record, overwriting the oldest if the buffer is full
+ * @param kind Kind of record
+ * @param cmd Command, for TRACE_KIND_CMD
+ */
+static void traceStart(unsigned char kind, unsigned char cmd){
+    trace_record_t* r = &records[next];
+    r->kind = kind;
+    r->cmd = cmd;
+    r->count = 0;
+    current = next;
+    
+    next = (next + 1 == TRACE_RECORDS) ? 0 : next + 1;
+    if(numRecords < TRACE_RECORDS){
+        numRecords++;
+    }
+    else if(dropped < 0xFFFF){
+        dropped++;
+    }
+}
+
+/**
+ * @brief Sends a byte over the EUSART as two hex digits, preceded by a space
+ * @param byte The byte
+ */
+static void tracePutHex(unsigned char byte){
+    static const char HEX[] = "0123456789ABCDEF";
+    halUartPutc(' ');
+    halUartPutc(HEX[byte >> 4]);
+    halUartPutc(HEX[byte & 0x0F]);
+}
+
+/**
+ * @brief Sends a number over the EUSART in decimal, preceded by a space
+ * @param n The number
+ */
+static void tracePutNumber(unsigned short n){
+    char digits[6];
+    unsigned char i = sizeof(digits);
+    digits[--i] = '\0';
+    do{
+        digits[--i] = '0' + (n % 10);
+        n /= 10;
+    }while(n > 0);
+    halUartPutc(' ');
+    halUartPuts(&digits[i]);
+}
+
+/***************************** Public Functions ******************************/
+void glcdTraceByte(unsigned char byte, unsigned char isCmd){
+    if(isCmd){
+        traceStart(TRACE_KIND_CMD, byte);
+        return;
+    }
+    
+    if(current == NO_RECORD){
+        traceStart(TRACE_KIND_DATA, 0);
+    }
+    trace_record_t* r = &records[current];
+    if(r->count < TRACE_PARAMS){
+        r->params[r->count] = byte;
+    }
+    if(r->count < 0xFFFF){
+        r->count++;
+    }
+}
+
+void glcdTraceData(unsigned long numBytes){
+    if(current == NO_RECORD){
+        traceStart(TRACE_KIND_DATA, 0);
+    }
+    trace_record_t* r = &records[current];
+    r->count = (numBytes < 0xFFFFUL - r->count) ? r->count + numBytes : 0xFFFF;
+}
+
+void glcdTraceMarkFrame(void){
+    // glcdQueueServiceISR records what it sends, so keep it out while the
+    // records change
+    unsigned char queueing = PIE1bits.SSPIE;
+    mssp_int_disable();
+    traceStart(TRACE_KIND_FRAME, 0);
+    current = NO_RECORD;
+    if(queueing){
+        mssp_int_enable();
+    }
+}
+
+void glcdTraceClear(void){
+    unsigned char queueing = PIE1bits.SSPIE;
+    mssp_int_disable();
+    next = 0;
+    numRecords = 0;
+    dropped = 0;
+    current = NO_RECORD;
+    if(queueing){
+        mssp_int_enable();
+    }
+}
+
+void glcdTraceDump(void){
+    unsigned char queueing = PIE1bits.SSPIE;
+    mssp_int_disable();
+    halUartPuts("TRACE");
+    tracePutNumber(numRecords);
+    tracePutNumber(dropped);
+    halUartPuts("\r\n");
+    
+    unsigned char i = (next + TRACE_RECORDS - numRecords) % TRACE_RECORDS;
+    for(unsigned char n = 0; n < numRecords; n++){
+        const trace_record_t* r = &records[i];
+        halUartPutc(r->kind);
+        if(r->kind == TRACE_KIND_CMD){
+            tracePutHex(r->cmd);
+            tracePutNumber(r->count);
+            for(unsigned char p = 0; (p < r->count) && (p < TRACE_PARAMS); p++){
+                tracePutHex(r->params[p]);
+            }
+        }
+        else if(r->kind == TRACE_KIND_DATA){
+            tracePutNumber(r->count);
+        }
+        halUartPuts("\r\n");
+        i = (i + 1 == TRACE_RECORDS) ? 0 : i + 1;
+    }
+    halUartPuts("END\r\n");
+    if(queueing){
+        mssp_int_enable();
+    }
+}
+
+#endif /* GLCD_TRACE */
@@ -0,0 +1,103 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Trace
+ * @brief Records what the driver sends to the display in a ring buffer
+ * @details When GLCD_TRACE is defined, every command the driver sends is
+ *          logged as a compact record: the command, how many parameter or
+ *          pixel data bytes followed it, and the first few of those bytes.
+ *          That's enough to see the windows (CASET/RASET), mode changes
+ *          (MADCTL, COLMOD, ...) and how much pixel data went into each
+ *          window, without storing the pixels themselves. Once the buffer is
+ *          full, the oldest records are overwritten.
+ *
+ *          glcdTraceDump sends the records over the EUSART as text, which
+ *          host/trace/ST7735R_Trace.c replays through the controller model
+ *          to point out wasted bus time. The format is one record per line:
+ *          @code
+ *          TRACE <records> <dropped>   Header: records that follow, and
+ *                                      older ones that were overwritten
+ *          C <cmd> <count> <p0> ...    A command (hex), the number of bytes
+ *                                      that followed it (decimal, at most
+ *                                      65535), and the first of them (hex,
+ *                                      up to TRACE_PARAMS)
+ *          D <count>                   Data whose command was overwritten
+ *          F                           Frame marker (glcdTraceMarkFrame)
+ *          END
+ *          @endcode
+ *
+ *          Each record takes 8 bytes of RAM
+ * @{
+ */
+
+#ifndef GLCD_TRACE_H
+#define GLCD_TRACE_H
+
+/********************************* Includes **********************************/
+#include "../HAL/HAL.h"
+
+/********************************** Macros ***********************************/
+// Define this to record what's sent to the display. Without it, the trace
+// hooks in the driver compile to nothing and its functions are left out
+// #define GLCD_TRACE
+
+/** @brief Records kept in the ring buffer */
+#define TRACE_RECORDS 32
+
+/** @brief Parameter bytes kept for each command */
+#define TRACE_PARAMS 4
+
+#if defined(GLCD_TRACE)
+/** @brief Records a byte sent with glcdTransfer or from the queue */
+#define TRACE_BYTE(byte, isCmd) glcdTraceByte((byte), (isCmd))
+
+/** @brief Records pixel data bytes sent straight to the SPI module */
+#define TRACE_DATA(numBytes) glcdTraceData(numBytes)
+#else
+#define TRACE_BYTE(byte, isCmd)
+#define TRACE_DATA(numBytes)
+#endif
+
+#if defined(GLCD_TRACE)
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Records a byte sent to the display. Called by TRACE_BYTE
+ * @param byte The byte
+ * @param isCmd 1 if it was sent as a command, 0 if as data
+ */
+void glcdTraceByte(unsigned char byte, unsigned char isCmd);
+
+/**
+ * @brief Records data bytes without keeping them. Called by TRACE_DATA
+ * @param numBytes How many were sent
+ */
+void glcdTraceData(unsigned long numBytes);
+
+/**
+ * @brief Records the end of a frame, so that the analysis can tell pixels
+ *        overwritten within a frame from those redrawn in the next one
+ * @note This, glcdTraceClear and glcdTraceDump hold off the MSSP interrupt
+ *       while they change or read the records, since glcdQueueServiceISR
+ *       adds to them
+ */
+void glcdTraceMarkFrame(void);
+
+/** @brief Empties the ring buffer */
+void glcdTraceClear(void);
+
+/**
+ * @brief Sends the records over the EUSART (see halUartInit), oldest first,
+ *        in the format above. The buffer is left as it is
+ * @note A queue that is sending (see GLCD_Queue.h) is paused until the dump
+ *       is done
+ */
+void glcdTraceDump(void);
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_TRACE_H */
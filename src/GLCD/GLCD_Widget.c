@@ -0,0 +1,174 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup GLCD_Widget
+ */
+
+/********************************* Includes **********************************/
+#include <stdio.h>
+#include "GLCD_Widget.h"
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Fills the part of a bar between two levels
+ * @param bar The bar
+ * @param from First filled pixel along the bar
+ * @param to End filled pixel along the bar (exclusive)
+ * @param color Color to fill with
+ */
+static void widgetFillBar(
+    const glcd_bar_t* bar,
+    unsigned char from,
+    unsigned char to,
+    unsigned long color
+)
+{
+    if(from >= to){
+        return;
+    }
+    if(bar->axis == AXIS_X){
+        glcdDrawRectangle(
+            bar->XS + from,
+            bar->XS + to,
+            bar->YS,
+            bar->YE,
+            color
+        );
+    }
+    else{
+        glcdDrawRectangle(
+            bar->XS,
+            bar->XE,
+            bar->YS + from,
+            bar->YS + to,
+            color
+        );
+    }
+}
+
+/***************************** Public Functions ******************************/
+void glcdBarInit(
+    glcd_bar_t* bar,
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    glcd_axis_e axis,
+    unsigned char border,
+    unsigned long fg,
+    unsigned long bg
+)
+{
+    // The frame takes up the outermost pixels, and the fill area the rest
+    border = (border && (XE - XS > 2) && (YE - YS > 2)) ? 1 : 0;
+    bar->XS = XS + border;
+    bar->XE = XE - border;
+    bar->YS = YS + border;
+    bar->YE = YE - border;
+    bar->axis = axis;
+    bar->border = border;
+    bar->fg = fg;
+    bar->bg = bg;
+    bar->level = 0;
+    bar->drawn = 0;
+}
+
+void glcdBarSet(glcd_bar_t* bar, unsigned short value, unsigned short max){
+    unsigned char length = (bar->axis == AXIS_X) ?
+        bar->XE - bar->XS : bar->YE - bar->YS;
+    if((max == 0) || (value > max)){
+        value = max;
+    }
+    unsigned char level = (max == 0) ?
+        0 : (unsigned char)(((unsigned long)value * length) / max);
+    
+    if(!bar->drawn){
+        if(bar->border){
+            unsigned char XS = bar->XS - 1, XE = bar->XE + 1;
+            unsigned char YS = bar->YS - 1, YE = bar->YE + 1;
+            glcdDrawRectangle(XS, XE, YS, YS + 1, bar->fg);
+            glcdDrawRectangle(XS, XE, YE - 1, YE, bar->fg);
+            glcdDrawRectangle(XS, XS + 1, YS + 1, YE - 1, bar->fg);
+            glcdDrawRectangle(XE - 1, XE, YS + 1, YE - 1, bar->fg);
+        }
+        widgetFillBar(bar, 0, level, bar->fg);
+        widgetFillBar(bar, level, length, bar->bg);
+        bar->drawn = 1;
+    }
+    else if(level > bar->level){
+        widgetFillBar(bar, bar->level, level, bar->fg);
+    }
+    else{
+        widgetFillBar(bar, level, bar->level, bar->bg);
+    }
+    bar->level = level;
+}
+
+void glcdReadoutInit(
+    glcd_readout_t* readout,
+    unsigned char x,
+    unsigned char y,
+    unsigned char width,
+    unsigned long fg,
+    unsigned long bg
+)
+{
+    readout->x = x;
+    readout->y = y;
+    readout->width = (width < READOUT_MAX_CHARS) ? width : READOUT_MAX_CHARS;
+    readout->fg = fg;
+    readout->bg = bg;
+    readout->drawn = 0;
+}
+
+void glcdReadoutSetText(glcd_readout_t* readout, const char* str){
+    char text[READOUT_MAX_CHARS + 1];
+    unsigned char i = 0;
+    for(; (i < readout->width) && (str[i] != '\0'); i++){
+        text[i] = str[i];
+    }
+    for(; i < readout->width; i++){
+        text[i] = ' ';
+    }
+    
+    // Draw each run of changed characters as one string
+    i = 0;
+    while(i < readout->width){
+        if(readout->drawn && (text[i] == readout->text[i])){
+            i++;
+            continue;
+        }
+        
+        unsigned char first = i;
+        while((i < readout->width) &&
+              (!readout->drawn || (text[i] != readout->text[i]))){
+            readout->text[i] = text[i];
+            i++;
+        }
+        char end = text[i];
+        text[i] = '\0';
+        glcdDrawString(
+            readout->x + first * FONT_CHAR_WIDTH,
+            readout->y,
+            &text[first],
+            readout->fg,
+            readout->bg
+        );
+        text[i] = end;
+    }
+    readout->drawn = 1;
+}
+
+void glcdReadoutSetNumber(glcd_readout_t* readout, long value){
+    char text[READOUT_MAX_CHARS + 1];
+    int len = snprintf(text, sizeof(text), "%*ld", readout->width, value);
+    if(len > readout->width){
+        // Doesn't fit. Show that, rather than the wrong digits
+        for(unsigned char i = 0; i < readout->width; i++){
+            text[i] = '#';
+        }
+    }
+    glcdReadoutSetText(readout, text);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup GLCD_Widget
+ * @brief Dashboard widgets that only redraw what changed
+ * @details Each widget remembers what it last drew. A bar only draws the
+ *          strip between its old and new fill levels, and a readout only the
+ *          characters that are different from before. Each widget is drawn in
+ *          full the first time it's updated, and after glcdWidgetInvalidate
+ * @{
+ */
+
+#ifndef GLCD_WIDGET_H
+#define GLCD_WIDGET_H
+
+/********************************* Includes **********************************/
+#include "GLCD_PIC.h"
+#include "GLCD_Font.h"
+
+/********************************** Macros ***********************************/
+/** @brief Most characters a readout can show */
+#define READOUT_MAX_CHARS 10
+
+/********************************** Types ************************************/
+/** @brief A bar gauge or progress bar */
+typedef struct{
+    unsigned char XS;    /**< Fill area start on the x-axis */
+    unsigned char XE;    /**< Fill area end on the x-axis (exclusive) */
+    unsigned char YS;    /**< Fill area start on the y-axis */
+    unsigned char YE;    /**< Fill area end on the y-axis (exclusive) */
+    glcd_axis_e axis;    /**< Axis the bar fills along, from its start */
+    unsigned char border; /**< 1 to draw a frame around the fill area */
+    unsigned long fg;    /**< Filled color (and frame color) */
+    unsigned long bg;    /**< Empty color */
+    unsigned char level; /**< Filled pixels drawn last time */
+    unsigned char drawn; /**< 0 until drawn in full */
+}glcd_bar_t;
+
+/** @brief A text or numeric readout on a single line */
+typedef struct{
+    unsigned char x;     /**< x-position of the first character cell */
+    unsigned char y;     /**< y-position of the first character cell */
+    unsigned char width; /**< Characters shown (max: READOUT_MAX_CHARS) */
+    unsigned long fg;    /**< Color of the characters */
+    unsigned long bg;    /**< Color of the rest of the cells */
+    char text[READOUT_MAX_CHARS]; /**< Characters drawn last time */
+    unsigned char drawn; /**< 0 until drawn in full */
+}glcd_readout_t;
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Sets up a bar. Nothing is drawn until the first glcdBarSet
+ * @param bar The bar
+ * @param XS Start position on the x-axis
+ * @param XE End position on the x-axis (exclusive)
+ * @param YS Start position on the y-axis
+ * @param YE End position on the y-axis (exclusive)
+ * @param axis Axis the bar fills along
+ * @param border 1 to draw a 1-pixel frame inside the rectangle, around the
+ *        fill area (a progress bar), 0 for none (a bar gauge)
+ * @param fg Filled color (and frame color)
+ * @param bg Empty color
+ */
+void glcdBarInit(
+    glcd_bar_t* bar,
+    unsigned char XS,
+    unsigned char XE,
+    unsigned char YS,
+    unsigned char YE,
+    glcd_axis_e axis,
+    unsigned char border,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @brief Sets the fill level of a bar, drawing only the part that changed
+ * @param bar The bar
+ * @param value The value (max: max)
+ * @param max The value of a full bar (e.g. 100 for a percentage)
+ */
+void glcdBarSet(glcd_bar_t* bar, unsigned short value, unsigned short max);
+
+/**
+ * @brief Sets up a readout. Nothing is drawn until the first update
+ * @param readout The readout
+ * @param x x-position of the first character cell
+ * @param y y-position of the first character cell
+ * @param width Characters shown (max: READOUT_MAX_CHARS)
+ * @param fg Color of the characters
+ * @param bg Color of the rest of the cells
+ */
+void glcdReadoutInit(
+    glcd_readout_t* readout,
+    unsigned char x,
+    unsigned char y,
+    unsigned char width,
+    unsigned long fg,
+    unsigned long bg
+);
+
+/**
+ * @brief Shows text in a readout, drawing only the characters that changed.
+ *        Text shorter than the readout is padded with spaces, and longer text
+ *        is cut off
+ * @param readout The readout
+ * @param str The null-terminated text
+ */
+void glcdReadoutSetText(glcd_readout_t* readout, const char* str);
+
+/**
+ * @brief Shows a number in a readout, right-aligned, drawing only the digits
+ *        that changed. Numbers too wide for the readout are shown as '#'s
+ * @param readout The readout
+ * @param value The number
+ */
+void glcdReadoutSetNumber(glcd_readout_t* readout, long value);
+
+/**
+ * @brief Makes a widget draw itself in full on its next update, e.g. after
+ *        the screen was cleared
+ * @param drawn The drawn field of the widget
+ */
+#define glcdWidgetInvalidate(drawn) ((drawn) = 0)
+
+/**
+ * @}
+ */
+
+#endif /* GLCD_WIDGET_H */
@@ -0,0 +1,115 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup HAL
+ * @brief Hardware abstraction for the drivers
+ * @details The drivers are written against the PIC18F4620's registers (LATD,
+ *          PORTD, TRISC, ...), its SPI driver (SPI_PIC.h) and the XC8 delay
+ *          macros. This header supplies those for the platform being built
+ *          for, so the same driver sources build for the PIC with XC8, and
+ *          for a PC with gcc:
+ *           - XC8: HAL_XC8.h includes the device headers, and HAL_XC8.c
+ *             implements the tick
+ *           - Anything else: HAL_Linux.h models the registers the drivers
+ *             use, and HAL_Linux.c implements delays and the tick, passing
+ *             pin changes and the bytes written to SSPBUF to a backend such
+ *             as the controller emulator
+ *
+ *          SPI_PIC.c is the SPI driver on both
+ *
+ *          On both, the tick is a free-running 16-bit count of instruction
+ *          cycles (FOSC / 4). It can be extended to 32 bits by counting its
+ *          overflows in the interrupt, if the application opts in (see
+ *          halTickEnableOverflow and halTickServiceISR). The EUSART
+ *          sends text out of the PIC's TX pin, or to stdout on a PC.
+ *
+ *          Code that waits for an interrupt handler calls halPoll while it
+ *          waits. On the PIC that does nothing, since the interrupt comes in
+ *          by itself; on a PC it runs the handler set with halLinuxSetISR
+ * @{
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+/********************************* Includes **********************************/
+#if defined(__XC8)
+#include "HAL_XC8.h"
+#else
+#include "HAL_Linux.h"
+#endif
+
+/********************************** Macros ***********************************/
+/** @brief Baud rate set by halUartInit */
+#define HAL_UART_BAUD 57600UL
+
+/** @brief Evaluates to 1 if the tick's overflow interrupt is pending */
+#define tick_int_pending() (PIE1bits.TMR1IE && PIR1bits.TMR1IF)
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Starts the tick counting. Its overflow interrupt stays disabled (see
+ *        halTickEnableOverflow)
+ */
+void halTickInit(void);
+
+/**
+ * @brief Enables the tick's overflow interrupt, so that halGetTickLong counts
+ *        beyond 65536 cycles. Only call this if the interrupt handler calls
+ *        halTickServiceISR when tick_int_pending() is true; otherwise the
+ *        flag is never cleared and the handler runs again and again once GIE
+ *        and PEIE are set
+ */
+void halTickEnableOverflow(void);
+
+/**
+ * @brief Reads the tick
+ * @return Instruction cycles, modulo 65536
+ */
+unsigned short halGetTick(void);
+
+/**
+ * @brief Reads the tick, extended with the overflows counted by
+ *        halTickServiceISR. Without the interrupt, this counts the overflow
+ *        itself, so it must be called at least once every 65536 cycles to
+ *        count all of them. The difference between two reads less than 65536
+ *        cycles apart is always right
+ * @return Instruction cycles, modulo 2^32
+ */
+unsigned long halGetTickLong(void);
+
+/**
+ * @brief Counts an overflow of the tick. Call this from the interrupt handler
+ *        when tick_int_pending() is true
+ */
+void halTickServiceISR(void);
+
+/**
+ * @brief Called in loops that wait for an interrupt handler to do something,
+ *        e.g. glcdQueueSubmit waiting for the queue to be sent (see the
+ *        details above)
+ */
+void halPoll(void);
+
+/** @brief Sets up the EUSART to send at HAL_UART_BAUD, 8N1 */
+void halUartInit(void);
+
+/**
+ * @brief Sends a character over the EUSART, waiting for room first
+ * @param c The character
+ */
+void halUartPutc(char c);
+
+/**
+ * @brief Sends a string over the EUSART
+ * @param str The null-terminated string
+ */
+void halUartPuts(const char* str);
+
+/**
+ * @}
+ */
+
+#endif /* HAL_H */
@@ -0,0 +1,206 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup HAL
+ */
+
+/********************************* Includes **********************************/
+#include "HAL.h"
+
+#if !defined(__XC8)
+
+#include <stdio.h>
+#include "../SPI/SPI_PIC.h"
+
+/***************************** Public Variables ******************************/
+volatile hal_trisd_t TRISDbits;
+volatile hal_trisc_t TRISCbits;
+volatile hal_pie1_t PIE1bits;
+volatile hal_sspcon1_t SSPCON1bits;
+volatile unsigned char SSPIF;
+
+/***************************** Private Variables *****************************/
+static const hal_backend_t* backend = 0;
+
+static volatile hal_latd_t latd = {.reg = 0xFF};
+static unsigned char latdSeen = 0xFF; /**< LATD as last passed on */
+static volatile hal_portd_t portd;
+
+static volatile unsigned short sspbuf = HAL_SSPBUF_IDLE | 0xFF;
+static volatile hal_sspstat_t sspstat;
+static volatile hal_pir1_t pir1;
+
+static unsigned long long cycles = 0; /**< Simulated instruction cycles */
+static void (*handler)(void) = 0; /**< Stands in for the interrupt handler */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Finds the FOSC divider of the SPI clock selected in SSPCON1
+ * @return 4, 16, or 64
+ */
+static unsigned char halLinuxGetDivider(void){
+    switch(SSPCON1bits.SSPM){
+        case 0b0000:
+            return 4;
+        case 0b0010:
+            return 64;
+        default:
+            return 16;
+    }
+}
+
+/**
+ * @brief Exchanges the byte written to SSPBUF with the backend, as the MSSP
+ *        would shift it out, and flags the end of the transfer
+ */
+static void halLinuxShift(void){
+    unsigned char received = 0xFF;
+    
+    // 8 bits at FOSC / divider, and the driver code around the byte
+    cycles += spi_byte_cycles(halLinuxGetDivider());
+    
+    if((backend != 0) && (backend->spiTransfer != 0)){
+        received = backend->spiTransfer(backend->ctx, sspbuf & 0xFF);
+    }
+    sspbuf = HAL_SSPBUF_IDLE | received;
+    sspstat.BF = 1;
+    pir1.SSPIF = 1;
+}
+
+/***************************** Public Functions ******************************/
+volatile hal_latd_t* halLinuxLATD(void){
+    halLinuxSync();
+    return &latd;
+}
+
+volatile hal_portd_t* halLinuxPORTD(void){
+    halLinuxSync();
+    unsigned char levels = 0;
+    for(unsigned char bit = 0; bit < 8; bit++){
+        unsigned char level = (latd.reg >> bit) & 1;
+        if((backend != 0) && (backend->pinRead != 0)){
+            level = backend->pinRead(backend->ctx, 'D', bit) ? 1 : 0;
+        }
+        levels |= level << bit;
+    }
+    portd.reg = levels;
+    return &portd;
+}
+
+void halLinuxSetBackend(const hal_backend_t* newBackend){
+    halLinuxSync();
+    backend = newBackend;
+    
+    // Let the new backend know where every pin stands
+    if((backend != 0) && (backend->pinWrite != 0)){
+        for(unsigned char bit = 0; bit < 8; bit++){
+            backend->pinWrite(backend->ctx, 'D', bit, (latdSeen >> bit) & 1);
+        }
+    }
+}
+
+const hal_backend_t* halLinuxGetBackend(void){
+    return backend;
+}
+
+volatile unsigned short* halLinuxSSPBUF(void){
+    halLinuxSync();
+    sspstat.BF = 0;
+    return &sspbuf;
+}
+
+volatile hal_sspstat_t* halLinuxSSPSTAT(void){
+    halLinuxSync();
+    return &sspstat;
+}
+
+volatile hal_pir1_t* halLinuxPIR1(void){
+    halLinuxSync();
+    return &pir1;
+}
+
+void halLinuxSync(void){
+    // Any latch change made before the byte was written to SSPBUF was passed
+    // on when SSPBUF was accessed, so the byte goes first
+    if(!(sspbuf & HAL_SSPBUF_IDLE)){
+        halLinuxShift();
+    }
+    SSPIF = pir1.SSPIF;
+    
+    unsigned char changed = latd.reg ^ latdSeen;
+    if(changed == 0){
+        return;
+    }
+    
+    latdSeen = latd.reg;
+    if((backend == 0) || (backend->pinWrite == 0)){
+        return;
+    }
+    for(unsigned char bit = 0; bit < 8; bit++){
+        if(changed & (1 << bit)){
+            backend->pinWrite(backend->ctx, 'D', bit, (latdSeen >> bit) & 1);
+        }
+    }
+}
+
+void halLinuxSetISR(void (*isr)(void)){
+    handler = isr;
+}
+
+void halLinuxDelayUs(unsigned long us){
+    halLinuxSync();
+    cycles += ((unsigned long long)us * (_XTAL_FREQ / 4)) / 1000000ULL;
+}
+
+void halLinuxAddCycles(unsigned long n){
+    cycles += n;
+}
+
+unsigned long long halLinuxGetCycles(void){
+    return cycles;
+}
+
+void halTickInit(void){
+    // Always running
+}
+
+void halTickEnableOverflow(void){
+    // The simulated tick doesn't overflow
+    PIE1bits.TMR1IE = 1;
+}
+
+unsigned short halGetTick(void){
+    return (unsigned short)cycles;
+}
+
+unsigned long halGetTickLong(void){
+    return (unsigned long)(cycles & 0xFFFFFFFFUL);
+}
+
+void halTickServiceISR(void){
+    // Never pending, since the simulated tick doesn't overflow
+    pir1.TMR1IF = 0;
+}
+
+void halPoll(void){
+    // As if the interrupt came in while waiting
+    if(handler != 0){
+        handler();
+    }
+}
+
+void halUartInit(void){
+    // Nothing to set up: the EUSART is stdout
+}
+
+void halUartPutc(char c){
+    fputc(c, stdout);
+}
+
+void halUartPuts(const char* str){
+    fputs(str, stdout);
+}
+
+#endif /* !__XC8 */
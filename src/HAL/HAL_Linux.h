@@ -0,0 +1,294 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup HAL
+ * @brief Linux implementation of the hardware abstraction
+ * @details Models the PIC registers the drivers use, so that SPI_PIC.c builds
+ *          as it is. Writes to LATD are passed to the backend as pin changes,
+ *          reads of PORTD are answered by it, and bytes written to SSPBUF are
+ *          exchanged with it, after which BF and SSPIF are set and SSPBUF
+ *          holds the byte received. Without a backend, pins go nowhere and
+ *          SPI reads return 0xFF.
+ *
+ *          Plain memory writes can't be intercepted, so LATD changes and
+ *          SSPBUF writes are noticed the next time the drivers touch LATD,
+ *          PORTD, SSPBUF, SSPSTAT or PIR1 (or halLinuxSync is called). Each of
+ *          those passes on what's pending first, so the backend sees every
+ *          edge and byte in the order the drivers wrote them. SSPBUF is wider
+ *          than a byte so that a write can be told apart: while nothing is
+ *          pending, it holds the byte received with HAL_SSPBUF_IDLE set, which
+ *          a read truncates away. SSPIF on its own can't be a macro without
+ *          breaking PIR1bits.SSPIF, so it's a copy of that bit, updated at
+ *          each of those accesses.
+ *
+ *          Interrupts aren't simulated on their own. Instead, halPoll runs a
+ *          handler given with halLinuxSetISR, so that code waiting for the
+ *          interrupt (e.g. the MSSP interrupt sending the display queue)
+ *          makes progress.
+ *
+ *          Time is simulated: it advances by the length of each SPI transfer
+ *          at the clock selected by SSPCON1, plus the driver code around it
+ *          (see spi_byte_cycles), and by each delay, instead of actually
+ *          waiting
+ */
+
+#ifndef HAL_LINUX_H
+#define HAL_LINUX_H
+
+/********************************** Macros ***********************************/
+#ifndef _XTAL_FREQ
+#define _XTAL_FREQ 10000000 /**< Oscillator frequency being simulated */
+#endif
+
+/** @brief Simulated delay, in milliseconds */
+#define __delay_ms(x) halLinuxDelayUs((unsigned long)(x) * 1000UL)
+
+/** @brief Simulated delay, in microseconds */
+#define __delay_us(x) halLinuxDelayUs((unsigned long)(x))
+
+#define LATDbits  (*halLinuxLATD())  /**< Port D output latches */
+#define LATD      (halLinuxLATD()->reg) /**< Port D output latches, as a byte */
+#define PORTDbits (*halLinuxPORTD()) /**< Port D pin levels */
+#define TRISD     (TRISDbits.reg)    /**< Port D data direction, as a byte */
+
+#define SSPBUF      (*halLinuxSSPBUF())       /**< MSSP buffer */
+#define SSPSTATbits (*halLinuxSSPSTAT())      /**< MSSP status */
+#define SSPSTAT     (halLinuxSSPSTAT()->reg)  /**< MSSP status, as a byte */
+#define SSPCON1     (SSPCON1bits.reg)         /**< MSSP control, as a byte */
+#define PIR1bits    (*halLinuxPIR1())         /**< Peripheral interrupt flags */
+
+/** @brief Set in SSPBUF while no byte written to it is waiting to go out */
+#define HAL_SSPBUF_IDLE 0x100
+
+/********************************** Types ************************************/
+/** @brief Port D output latches */
+typedef union{
+    struct{
+        unsigned LATD0 :1;
+        unsigned LATD1 :1;
+        unsigned LATD2 :1;
+        unsigned LATD3 :1;
+        unsigned LATD4 :1;
+        unsigned LATD5 :1;
+        unsigned LATD6 :1;
+        unsigned LATD7 :1;
+    };
+    unsigned char reg;
+}hal_latd_t;
+
+/** @brief Port D pin levels */
+typedef union{
+    struct{
+        unsigned RD0 :1;
+        unsigned RD1 :1;
+        unsigned RD2 :1;
+        unsigned RD3 :1;
+        unsigned RD4 :1;
+        unsigned RD5 :1;
+        unsigned RD6 :1;
+        unsigned RD7 :1;
+    };
+    unsigned char reg;
+}hal_portd_t;
+
+/** @brief Port D data direction */
+typedef union{
+    struct{
+        unsigned TRISD0 :1;
+        unsigned TRISD1 :1;
+        unsigned TRISD2 :1;
+        unsigned TRISD3 :1;
+        unsigned TRISD4 :1;
+        unsigned TRISD5 :1;
+        unsigned TRISD6 :1;
+        unsigned TRISD7 :1;
+    };
+    unsigned char reg;
+}hal_trisd_t;
+
+/** @brief Port C data direction */
+typedef struct{
+    unsigned TRISC0 :1;
+    unsigned TRISC1 :1;
+    unsigned TRISC2 :1;
+    unsigned TRISC3 :1;
+    unsigned TRISC4 :1;
+    unsigned TRISC5 :1;
+    unsigned TRISC6 :1;
+    unsigned TRISC7 :1;
+}hal_trisc_t;
+
+/** @brief Peripheral interrupt enables */
+typedef struct{
+    unsigned TMR1IE :1;
+    unsigned TMR2IE :1;
+    unsigned CCP1IE :1;
+    unsigned SSPIE  :1;
+    unsigned TXIE   :1;
+    unsigned RCIE   :1;
+    unsigned ADIE   :1;
+    unsigned PSPIE  :1;
+}hal_pie1_t;
+
+/** @brief Peripheral interrupt flags */
+typedef struct{
+    unsigned TMR1IF :1;
+    unsigned TMR2IF :1;
+    unsigned CCP1IF :1;
+    unsigned SSPIF  :1;
+    unsigned TXIF   :1;
+    unsigned RCIF   :1;
+    unsigned ADIF   :1;
+    unsigned PSPIF  :1;
+}hal_pir1_t;
+
+/** @brief MSSP status */
+typedef union{
+    struct{
+        unsigned BF      :1;
+        unsigned UA      :1;
+        unsigned R_NOT_W :1;
+        unsigned S       :1;
+        unsigned P       :1;
+        unsigned D_NOT_A :1;
+        unsigned CKE     :1;
+        unsigned SMP     :1;
+    };
+    unsigned char reg;
+}hal_sspstat_t;
+
+/** @brief MSSP control */
+typedef union{
+    struct{
+        unsigned SSPM  :4;
+        unsigned CKP   :1;
+        unsigned SSPEN :1;
+        unsigned SSPOV :1;
+        unsigned WCOL  :1;
+    };
+    unsigned char reg;
+}hal_sspcon1_t;
+
+/** @brief Where pin changes and SPI bytes go */
+typedef struct{
+    /**
+     * @brief Called when an output latch changes
+     * @param ctx The backend's context
+     * @param port The port ('D')
+     * @param bit The bit within the port
+     * @param level The new level
+     */
+    void (*pinWrite)(
+        void* ctx,
+        char port,
+        unsigned char bit,
+        unsigned char level
+    );
+    
+    /**
+     * @brief Called to read an input pin
+     * @param ctx The backend's context
+     * @param port The port ('D')
+     * @param bit The bit within the port
+     * @return The level
+     */
+    unsigned char (*pinRead)(void* ctx, char port, unsigned char bit);
+    
+    /**
+     * @brief Called to exchange a byte written to SSPBUF
+     * @param ctx The backend's context
+     * @param byte The byte sent
+     * @return The byte received
+     */
+    unsigned char (*spiTransfer)(void* ctx, unsigned char byte);
+    
+    void* ctx; /**< Passed to each of the above */
+}hal_backend_t;
+
+/******************************** Variables **********************************/
+extern volatile hal_trisd_t TRISDbits;
+extern volatile hal_trisc_t TRISCbits;
+extern volatile hal_pie1_t PIE1bits;
+extern volatile hal_sspcon1_t SSPCON1bits;
+extern volatile unsigned char SSPIF; /**< Copy of PIR1bits.SSPIF */
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Accesses the port D output latches (see LATDbits)
+ * @return The latches
+ */
+volatile hal_latd_t* halLinuxLATD(void);
+
+/**
+ * @brief Accesses the port D pin levels (see PORTDbits)
+ * @return The levels, as read from the backend
+ */
+volatile hal_portd_t* halLinuxPORTD(void);
+
+/**
+ * @brief Accesses the MSSP buffer (see SSPBUF). Whatever is accessed, BF is
+ *        cleared, since both reading the buffer and starting a transfer do
+ * @return The buffer
+ */
+volatile unsigned short* halLinuxSSPBUF(void);
+
+/**
+ * @brief Accesses the MSSP status (see SSPSTATbits)
+ * @return The status
+ */
+volatile hal_sspstat_t* halLinuxSSPSTAT(void);
+
+/**
+ * @brief Accesses the peripheral interrupt flags (see PIR1bits)
+ * @return The flags
+ */
+volatile hal_pir1_t* halLinuxPIR1(void);
+
+/**
+ * @brief Sets where pin changes and SPI bytes go
+ * @param backend The backend, or 0 for none. Must stay valid while in use
+ */
+void halLinuxSetBackend(const hal_backend_t* backend);
+
+/**
+ * @brief Gets where pin changes and SPI bytes go, e.g. so that a model of
+ *        another device on the bus can pass them on
+ * @return The backend, or 0 if there's none
+ */
+const hal_backend_t* halLinuxGetBackend(void);
+
+/**
+ * @brief Passes any pending SSPBUF write and output latch changes to the
+ *        backend
+ */
+void halLinuxSync(void);
+
+/**
+ * @brief Sets the function that stands in for the interrupt handler, which
+ *        halPoll calls
+ * @param isr The handler, or 0 for none. Like the real one, it should check
+ *        which interrupts are pending (e.g. mssp_int_pending())
+ */
+void halLinuxSetISR(void (*isr)(void));
+
+/**
+ * @brief Advances simulated time
+ * @param us Microseconds
+ */
+void halLinuxDelayUs(unsigned long us);
+
+/**
+ * @brief Advances simulated time, e.g. to account for CPU work
+ * @param cycles Instruction cycles
+ */
+void halLinuxAddCycles(unsigned long cycles);
+
+/**
+ * @brief Gets the simulated time
+ * @return Instruction cycles since the program started
+ */
+unsigned long long halLinuxGetCycles(void);
+
+#endif /* HAL_LINUX_H */
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup HAL
+ */
+
+/********************************* Includes **********************************/
+#include "HAL.h"
+
+#if defined(__XC8)
+
+/***************************** Private Variables *****************************/
+static volatile unsigned short tickHigh = 0; /**< TMR1 overflows */
+
+/***************************** Public Functions ******************************/
+void halTickInit(void){
+    // 16-bit reads, 1:1 prescale from the instruction clock, timer on
+    T1CON = 0b10000001;
+    PIR1bits.TMR1IF = 0;
+}
+
+void halTickEnableOverflow(void){
+    PIR1bits.TMR1IF = 0;
+    PIE1bits.TMR1IE = 1;
+}
+
+unsigned short halGetTick(void){
+    // Reading TMR1L latches TMR1H in 16-bit read mode, so read it first
+    unsigned char low = TMR1L;
+    unsigned char high = TMR1H;
+    return ((unsigned short)high << 8) | low;
+}
+
+unsigned long halGetTickLong(void){
+    unsigned short high, low;
+    
+    // Without the interrupt, nothing else clears the flag, so the overflow is
+    // counted here. It happened before TMR1 is read below
+    if(!PIE1bits.TMR1IE && PIR1bits.TMR1IF){
+        PIR1bits.TMR1IF = 0;
+        tickHigh++;
+    }
+    
+    do{
+        high = tickHigh;
+        low = halGetTick();
+    }while(high != tickHigh); // The interrupt came in between
+    
+    // An overflow that hasn't been serviced yet, e.g. because interrupts are
+    // disabled. A low count means it happened before TMR1 was read
+    if(PIR1bits.TMR1IF && (low < 0x8000)){
+        high++;
+    }
+    return ((unsigned long)high << 16) | low;
+}
+
+void halTickServiceISR(void){
+    PIR1bits.TMR1IF = 0;
+    tickHigh++;
+}
+
+void halPoll(void){
+    // The interrupt doesn't need any help
+}
+
+void halUartInit(void){
+    // Asynchronous, 8 bits, high-speed 16-bit baud rate generator: the baud
+    // rate is FOSC / (4 * (SPBRGH:SPBRG + 1))
+    const unsigned short brg =
+        ((_XTAL_FREQ + 2 * HAL_UART_BAUD) / (4 * HAL_UART_BAUD)) - 1;
+    TRISCbits.TRISC6 = 0; // TX
+    TRISCbits.TRISC7 = 1; // RX
+    BAUDCON = 0b00001000; // BRG16
+    SPBRGH = brg >> 8;
+    SPBRG = brg & 0xFF;
+    TXSTA = 0b00100100; // TXEN, BRGH
+    RCSTA = 0b10000000; // SPEN
+}
+
+void halUartPutc(char c){
+    while(!TXSTAbits.TRMT){
+        continue;
+    }
+    TXREG = c;
+}
+
+void halUartPuts(const char* str){
+    while(*str != '\0'){
+        halUartPutc(*str++);
+    }
+}
+
+#endif /* __XC8 */
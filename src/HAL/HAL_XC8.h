@@ -0,0 +1,18 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup HAL
+ * @brief XC8 (PIC18F4620) implementation of the hardware abstraction. The
+ *        registers and delay macros come straight from the device headers
+ */
+
+#ifndef HAL_XC8_H
+#define HAL_XC8_H
+
+/********************************* Includes **********************************/
+#include <xc.h>
+#include <configBits.h>
+
+#endif /* HAL_XC8_H */
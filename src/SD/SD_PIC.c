@@ -0,0 +1,214 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @ingroup SD
+ */
+
+/********************************* Includes **********************************/
+#include "SD_PIC.h"
+
+/******************************** Constants **********************************/
+// Commands (SD physical layer specification, section 7.3.1)
+static const unsigned char CMD_GO_IDLE_STATE = 0;
+static const unsigned char CMD_SEND_IF_COND = 8;
+static const unsigned char CMD_SET_BLOCKLEN = 16;
+static const unsigned char CMD_READ_SINGLE_BLOCK = 17;
+static const unsigned char CMD_APP_CMD = 55;
+static const unsigned char CMD_READ_OCR = 58;
+static const unsigned char ACMD_SD_SEND_OP_COND = 41;
+
+// R1 response bits
+static const unsigned char R1_IDLE = 0x01;
+static const unsigned char R1_ILLEGAL_COMMAND = 0x04;
+
+static const unsigned char DATA_START_TOKEN = 0xFE;
+
+// Argument of CMD8: 2.7-3.6 V, and a check pattern that the card echoes
+static const unsigned long IF_COND_ARG = 0x000001AAUL;
+
+// Argument of ACMD41 telling the card that high capacity is supported
+static const unsigned long HCS = 0x40000000UL;
+
+// Bit of the OCR's first byte set by high capacity cards
+static const unsigned char OCR_CCS = 0x40;
+
+// Attempts, 1 ms apart, for the card to leave the idle state (1 s)
+static const unsigned short INIT_ATTEMPTS = 1000;
+
+// Bytes to wait for the start of a data block. Reads take up to 100 ms, which
+// is about 31000 bytes at FOSC/4 with a 10 MHz oscillator
+static const unsigned short TOKEN_ATTEMPTS = 0xFFFF;
+
+/***************************** Private Variables *****************************/
+static unsigned char ready = 0; /**< 1 once sdInit succeeds */
+static unsigned char highCapacity = 0; /**< 1 if sectors are block addressed */
+
+/***************************** Private Functions *****************************/
+/**
+ * @brief Deselects the card, then clocks out one more byte so that it
+ *        releases its data line for the other devices on the bus
+ */
+static void sdDeselect(void){
+    CS_SD = 1;
+    spiTransfer(0xFF);
+}
+
+/**
+ * @brief Sends a command to the selected card and waits for its response
+ * @param cmd The command
+ * @param arg Its argument
+ * @return The R1 response, or 0xFF if the card didn't respond
+ */
+static unsigned char sdCommand(unsigned char cmd, unsigned long arg){
+    // The CRC is only checked for CMD0 and CMD8 while in SPI mode
+    unsigned char crc = 0x01;
+    if(cmd == CMD_GO_IDLE_STATE){
+        crc = 0x95;
+    }
+    else if(cmd == CMD_SEND_IF_COND){
+        crc = 0x87;
+    }
+    
+    spiTransfer(0x40 | cmd);
+    spiTransfer(arg >> 24);
+    spiTransfer(arg >> 16);
+    spiTransfer(arg >> 8);
+    spiTransfer(arg);
+    spiTransfer(crc);
+    
+    // The response comes within 8 bytes, and always has its MSb clear
+    unsigned char r1 = 0xFF;
+    for(unsigned char i = 0; (i < 8) && (r1 & 0x80); i++){
+        r1 = spiReceive();
+    }
+    return r1;
+}
+
+/**
+ * @brief Gets the rest of an R3 or R7 response
+ * @param bytes Where to put its 4 bytes
+ */
+static void sdReceiveLong(unsigned char* bytes){
+    for(unsigned char i = 0; i < 4; i++){
+        bytes[i] = spiReceive();
+    }
+}
+
+/**
+ * @brief Reads one sector from the selected card
+ * @param sector Number of the sector
+ * @param buf Where to put the data
+ * @return 1 if it was read, otherwise 0
+ */
+static unsigned char sdReadSector(unsigned long sector, unsigned char* buf){
+    unsigned long address = highCapacity ? sector : sector * SD_SECTOR_SIZE;
+    if(sdCommand(CMD_READ_SINGLE_BLOCK, address) != 0){
+        return 0;
+    }
+    
+    unsigned char token = 0xFF;
+    for(unsigned short i = 0; (i < TOKEN_ATTEMPTS) && (token == 0xFF); i++){
+        token = spiReceive();
+    }
+    if(token != DATA_START_TOKEN){
+        return 0;
+    }
+    
+    for(unsigned short i = 0; i < SD_SECTOR_SIZE; i++){
+        buf[i] = spiReceive();
+    }
+    spiReceive(); // CRC, unchecked
+    spiReceive();
+    return 1;
+}
+
+/***************************** Public Functions ******************************/
+unsigned char sdInit(void){
+    ready = 0;
+    highCapacity = 0;
+    TRIS_CS_SD = 0;
+    CS_SD = 1;
+    spiSetDivider(SD_INIT_DIVIDER);
+    
+    // At least 74 clocks with the card deselected to let it power up
+    for(unsigned char i = 0; i < 10; i++){
+        spiTransfer(0xFF);
+    }
+    
+    // Selecting the card while it receives CMD0 puts it in SPI mode
+    CS_SD = 0;
+    unsigned char r1 = 0xFF;
+    for(unsigned char i = 0; (i < 10) && (r1 != R1_IDLE); i++){
+        r1 = sdCommand(CMD_GO_IDLE_STATE, 0);
+    }
+    if(r1 != R1_IDLE){
+        sdDeselect();
+        return 0;
+    }
+    
+    // Version 2 cards echo CMD8's check pattern, version 1 cards reject it
+    unsigned char bytes[4];
+    unsigned char version2 = 0;
+    r1 = sdCommand(CMD_SEND_IF_COND, IF_COND_ARG);
+    if(!(r1 & R1_ILLEGAL_COMMAND)){
+        sdReceiveLong(bytes);
+        if(((bytes[2] & 0x0F) != 0x01) || (bytes[3] != 0xAA)){
+            sdDeselect();
+            return 0; // Unusable voltage range
+        }
+        version2 = 1;
+    }
+    
+    // Wait for the card to finish its initialization
+    r1 = R1_IDLE;
+    for(unsigned short i = 0; (i < INIT_ATTEMPTS) && (r1 != 0); i++){
+        sdCommand(CMD_APP_CMD, 0);
+        r1 = sdCommand(ACMD_SD_SEND_OP_COND, version2 ? HCS : 0);
+        if(r1 != 0){
+            __delay_ms(1);
+        }
+    }
+    if(r1 != 0){
+        sdDeselect();
+        return 0;
+    }
+    
+    // High capacity cards address sectors directly. The others take byte
+    // addresses, and are told to read a whole sector at a time
+    if(version2 && (sdCommand(CMD_READ_OCR, 0) == 0)){
+        sdReceiveLong(bytes);
+        highCapacity = (bytes[0] & OCR_CCS) ? 1 : 0;
+    }
+    if(!highCapacity && (sdCommand(CMD_SET_BLOCKLEN, SD_SECTOR_SIZE) != 0)){
+        sdDeselect();
+        return 0;
+    }
+    
+    sdDeselect();
+    spiSetDivider(SD_DIVIDER);
+    ready = 1;
+    return 1;
+}
+
+unsigned char sdReadSectors(
+    unsigned long sector,
+    unsigned char count,
+    unsigned char* buf
+)
+{
+    if(!ready){
+        return 0;
+    }
+    
+    spiSetDivider(SD_DIVIDER);
+    CS_SD = 0;
+    unsigned char success = 1;
+    for(unsigned char i = 0; (i < count) && success; i++){
+        success = sdReadSector(sector + i, buf);
+        buf += SD_SECTOR_SIZE;
+    }
+    sdDeselect();
+    return success;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file
+ *
+ * Created on October 18, 2026
+ *
+ * @defgroup SD
+ * @brief Reads sectors from an SD card in SPI mode
+ * @details The card shares the MSSP with the display, and has its own chip
+ *          select. It needs a slow clock (at most 400 kHz) until it's
+ *          initialized, and takes the fastest one after that. Functions that
+ *          use the bus select the card's clock with spiSetDivider, which does
+ *          nothing when the clock is already right, and leave it that way.
+ *
+ *          Only what's needed to read data is implemented: SD version 1 and
+ *          2 cards, standard (byte addressed) and high capacity (block
+ *          addressed), with sectors of SD_SECTOR_SIZE bytes. CRCs are not
+ *          checked
+ * @{
+ */
+
+#ifndef SD_PIC_H
+#define SD_PIC_H
+
+/********************************* Includes **********************************/
+#include "../SPI/SPI_PIC.h"
+
+/********************************** Macros ***********************************/
+// RD7 is the chip select of the SD card. It must not be shared with any of the
+// displays' chip selects (see CS_GLCD_MASK)
+#define CS_SD      LATDbits.LATD7   /**< Chip select     */
+#define TRIS_CS_SD TRISDbits.TRISD7 /**< TRIS for CS pin */
+
+/** @brief Bytes in a sector */
+#define SD_SECTOR_SIZE 512
+
+/**
+ * @brief FOSC divider for the clock during initialization. 64 keeps it under
+ *        400 kHz for oscillators up to 25.6 MHz
+ */
+#define SD_INIT_DIVIDER 64
+
+/** @brief FOSC divider for the clock after initialization */
+#define SD_DIVIDER 4
+
+/************************ Public Function Prototypes *************************/
+/**
+ * @brief Puts the card in SPI mode and waits for it to be ready. Must be
+ *        called after spiInit, and again whenever a card is inserted
+ * @return 1 if the card is ready to be read, 0 if there's no card or it
+ *         isn't supported
+ */
+unsigned char sdInit(void);
+
+/**
+ * @brief Reads consecutive sectors, selecting the card only once
+ * @param sector Number of the first sector
+ * @param count Number of sectors
+ * @param buf Where to put the data (count * SD_SECTOR_SIZE bytes)
+ * @return 1 if every sector was read, otherwise 0
+ */
+unsigned char sdReadSectors(
+    unsigned long sector,
+    unsigned char count,
+    unsigned char* buf
+);
+
+/**
+ * @}
+ */
+
+#endif /* SD_PIC_H */
@@ -10,8 +10,19 @@
 /********************************* Includes **********************************/
 #include "SPI_PIC.h"    
 
+/***************************** Private Variables *****************************/
+static unsigned char spiDivider = 16; /**< FOSC divider for the SPI clock */
+
+#if defined(SPI_PERF_COUNTERS)
+static unsigned long byteCount = 0;
+#endif
+
 /***************************** Public Functions ******************************/
 unsigned char spiTransfer(unsigned char byteToTransfer){   
+#if defined(SPI_PERF_COUNTERS)
+    byteCount++;
+#endif
+    
     // Write byte to buffer. This byte will be transferred to the shift register
     // and transmitted in hardware. As the bits to be transmitted are shifted 
     // out, the bits to be received are shifted in
@@ -34,6 +45,18 @@ unsigned char spiReceive(void){
     return spiTransfer(0xFF);
 }
 
+void spiStartSend(unsigned char val){
+#if defined(SPI_PERF_COUNTERS)
+    byteCount++;
+#endif
+    SSPBUF = val;
+}
+
+unsigned char spiFinishTransfer(void){
+    PIR1bits.SSPIF = 0;
+    return SSPBUF; // Reading the buffer clears BF
+}
+
 void spiInit(unsigned char divider){    
     mssp_disable();
     SSPSTAT = 0x00; // Default, data latched/shifted on rising edge
@@ -53,7 +76,9 @@ void spiInit(unsigned char divider){
             break;
         default:
             SSPCON1 = 0b00010001; // FOSC/16
+            divider = 16;
     }
+    spiDivider = divider;
 
     // Enforce correct pin configuration for relevant pins
     TRIS_SDO = 0;
@@ -61,4 +86,42 @@ void spiInit(unsigned char divider){
     TRIS_SCK = 0;
     
     mssp_enable();
-}
\ No newline at end of file
+}
+
+void spiSetDivider(unsigned char divider){
+    if(divider == spiDivider){
+        return;
+    }
+    
+    // The clock select bits are only changed while the module is disabled.
+    // Only the bits below SSPEN are written; the rest of SSPCON1 stays as set
+    // by spiInit
+    mssp_disable();
+    switch(divider){
+        case 4:
+            SSPCON1bits.SSPM = 0b0000;
+            break;
+        case 64:
+            SSPCON1bits.SSPM = 0b0010;
+            break;
+        default:
+            SSPCON1bits.SSPM = 0b0001; // FOSC/16
+            divider = 16;
+    }
+    spiDivider = divider;
+    mssp_enable();
+}
+
+unsigned char spiGetDivider(void){
+    return spiDivider;
+}
+
+#if defined(SPI_PERF_COUNTERS)
+unsigned long spiGetByteCount(void){
+    return byteCount;
+}
+
+void spiResetByteCount(void){
+    byteCount = 0;
+}
+#endif
\ No newline at end of file
@@ -13,8 +13,7 @@
 #define SPI_PIC_H
 
 /********************************* Includes **********************************/
-#include <xc.h>
-#include <configBits.h>
+#include "../HAL/HAL.h"
 
 /********************************** Macros ***********************************/
 #define TRIS_SDO TRISCbits.TRISC5 /**< Serial data out */
@@ -27,6 +26,31 @@
 /** @brief Disables the MSSP module */
 #define mssp_disable() SSPCON1bits.SSPEN = 0
 
+/** @brief Enables the MSSP interrupt (GIE and PEIE must also be set) */
+#define mssp_int_enable() PIE1bits.SSPIE = 1
+
+/** @brief Disables the MSSP interrupt */
+#define mssp_int_disable() PIE1bits.SSPIE = 0
+
+/** @brief Evaluates to 1 if the MSSP interrupt is enabled and pending */
+#define mssp_int_pending() (PIE1bits.SSPIE && PIR1bits.SSPIF)
+
+// Instruction cycles of driver code spent on each byte on top of the transfer
+// itself: the calls down to spiTransfer, setting RS and CS, loading SSPBUF and
+// polling for the end of the transfer. Drivers that plan their writes around
+// the bus timing use this, and the host build charges it to simulated time
+#define SPI_BYTE_OVERHEAD_CYCLES 20
+
+/**
+ * @brief Instruction cycles taken by each byte: 8 SPI clocks, which is
+ *        2 * divider instruction cycles, plus SPI_BYTE_OVERHEAD_CYCLES
+ */
+#define spi_byte_cycles(divider) (2UL * (divider) + SPI_BYTE_OVERHEAD_CYCLES)
+
+// Define this to count the bytes exchanged over the bus, with any device (see
+// spiGetByteCount). Without it, the counter is compiled out
+// #define SPI_PERF_COUNTERS
+
 /************************ Public Function Prototypes *************************/
 /**
  * @brief Transfers a byte using the SPI module, and returns the received byte.
@@ -47,6 +71,21 @@ unsigned char spiReceive(void);
  */
 void spiSend(unsigned char val);
 
+/**
+ * @brief Starts sending a byte, without waiting for the transfer to finish.
+ *        SSPIF is set when it does, so this is meant to be used from the MSSP
+ *        interrupt together with spiFinishTransfer
+ * @param val The byte to be sent
+ */
+void spiStartSend(unsigned char val);
+
+/**
+ * @brief Acknowledges a transfer started with spiStartSend, clearing SSPIF
+ *        and the buffer full flag
+ * @return The byte received
+ */
+unsigned char spiFinishTransfer(void);
+
 /**
  * @brief Initializes the MSSP module for SPI mode. All configuration register
  *        bits are written to because operating in I2C mode could change them.
@@ -55,6 +94,32 @@ void spiSend(unsigned char val);
  */
 void spiInit(unsigned char divider);
 
+/**
+ * @brief Changes the clock of the SPI module, e.g. when switching to a device
+ *        that needs a slower one. Nothing is written if the clock is already
+ *        at that divider
+ * @param divider The FOSC divider for the MSSP clock (4, 16, or 64)
+ */
+void spiSetDivider(unsigned char divider);
+
+/**
+ * @brief Gets the clock of the SPI module
+ * @return The FOSC divider set with spiInit or spiSetDivider
+ */
+unsigned char spiGetDivider(void);
+
+#if defined(SPI_PERF_COUNTERS)
+/**
+ * @brief Gets the number of bytes exchanged since the count was last reset,
+ *        including those started with spiStartSend
+ * @return The number of bytes
+ */
+unsigned long spiGetByteCount(void);
+
+/** @brief Sets the byte count to 0 */
+void spiResetByteCount(void);
+#endif
+
 /**
  * @}
  */